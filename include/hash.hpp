@@ -0,0 +1,28 @@
+/**
+ * @headerfile	hash.hpp "hash.hpp"
+ * @file	hash.hpp
+ * @brief	해시 함수
+ * @details	녹취 데이터 등 대용량 데이터를 구분하기 위한 128bit 비암호화 해시 (MurmurHash3 x64_128)
+ * @date	2026. 10. 18. 15:24:03
+ * @see
+ */
+#ifndef ITFACT_COMMON_HASH_HPP
+#define ITFACT_COMMON_HASH_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace itfact {
+	namespace common {
+		/// 128bit 해시 값
+		typedef struct {
+			uint64_t h1;
+			uint64_t h2;
+		} hash128_t;
+
+		hash128_t hash128(const void *data, const std::size_t len, const uint64_t seed = 0);
+		std::string toHex(const hash128_t &hash);
+	}
+}
+
+#endif /* ITFACT_COMMON_HASH_HPP */
@@ -0,0 +1,41 @@
+/**
+ * @headerfile	memory_file.hpp "memory_file.hpp"
+ * @file	memory_file.hpp
+ * @brief	메모리 파일
+ * @details	파일명을 인수로 받는 엔진 함수(SPLPostProcMLF 등)에 디스크 파일 대신 전달하기 위한 익명 파일.\n
+ 			memfd_create()로 생성하며 "/proc/self/fd/<fd>" 경로로 열 수 있다.
+ 			memfd_create()를 지원하지 않는 커널에서는 임시 디렉터리에 만든 후 바로 삭제한 파일을 사용한다.
+ * @date	2026. 10. 18. 21:32:06
+ * @see
+ */
+#ifndef ITFACT_COMMON_MEMORY_FILE_HPP
+#define ITFACT_COMMON_MEMORY_FILE_HPP
+
+#include <string>
+
+#include <boost/noncopyable.hpp>
+
+namespace itfact {
+	namespace common {
+		/**
+		 * @brief	경로로 접근할 수 있는 익명 파일
+		 */
+		class MemoryFile : private boost::noncopyable
+		{
+		private:
+			int fd = -1;
+			std::string pathname;
+
+		public:
+			explicit MemoryFile(const std::string &name, const std::string &tmp_path = "/tmp");
+			~MemoryFile();
+
+			bool isOpen() const {return fd >= 0;};
+			const std::string &getPath() const {return pathname;};
+			int write(const void *data, const std::size_t size);
+			int read(std::string &data) const;
+		};
+	}
+}
+
+#endif /* ITFACT_COMMON_MEMORY_FILE_HPP */
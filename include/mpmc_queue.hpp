@@ -0,0 +1,120 @@
+/**
+ * @headerfile	mpmc_queue.hpp "mpmc_queue.hpp"
+ * @file	mpmc_queue.hpp
+ * @brief	잠금 없는 고정 크기 MPMC 큐
+ * @details	여러 스레드가 동시에 넣고 꺼낼 수 있는 bounded queue (Dmitry Vyukov의 MPMC queue).\n
+ 			칸마다 순번(sequence)을 두어 넣기/꺼내기는 위치에 대한 CAS 한 번으로 끝나며, mutex를 사용하지 않는다.
+ 			크기는 2의 거듭제곱이 아니어도 된다.
+ * @date	2026. 10. 19. 05:21:09
+ * @see
+ */
+#ifndef ITFACT_COMMON_MPMC_QUEUE_HPP
+#define ITFACT_COMMON_MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <boost/noncopyable.hpp>
+
+namespace itfact {
+	namespace common {
+		/**
+		 * @brief	잠금 없는 고정 크기 MPMC 큐
+		 */
+		template <typename T>
+		class MPMCQueue : private boost::noncopyable
+		{
+		private:
+			static const std::size_t CACHELINE = 64;
+
+			typedef struct {
+				std::atomic<std::size_t> sequence;
+				T data;
+			} cell_t;
+
+			std::unique_ptr<cell_t[]> cells;
+			const std::size_t count;
+			char pad0[CACHELINE];
+			std::atomic<std::size_t> enqueue_pos;	///< 다음에 넣을 위치
+			char pad1[CACHELINE - sizeof(std::atomic<std::size_t>)];
+			std::atomic<std::size_t> dequeue_pos;	///< 다음에 꺼낼 위치
+			char pad2[CACHELINE - sizeof(std::atomic<std::size_t>)];
+
+		public:
+			/**
+			 * @param[in]	capacity	최대 항목 수 (0이면 1)
+			 */
+			explicit MPMCQueue(const std::size_t capacity)
+			: cells(new cell_t[capacity ? capacity : 1]), count(capacity ? capacity : 1), enqueue_pos(0), dequeue_pos(0) {
+				for (std::size_t i = 0; i < count; ++i)
+					cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+
+			std::size_t capacity() const {return count;};
+
+			/// 대략적인 항목 수 (통계용)
+			std::size_t size() const {
+				const std::size_t tail = dequeue_pos.load(std::memory_order_relaxed);
+				const std::size_t head = enqueue_pos.load(std::memory_order_relaxed);
+				return head > tail ? head - tail : 0;
+			}
+
+			/**
+			 * @brief		항목 넣기
+			 * @return		큐가 가득 찼으면 false (value는 그대로 유지)
+			 */
+			bool push(T &value) {
+				cell_t *cell;
+				std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+				for (;;) {
+					cell = &cells[pos % count];
+					const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+					const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+					if (diff == 0) {
+						if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break;
+					} else if (diff < 0) {
+						return false;
+					} else {
+						pos = enqueue_pos.load(std::memory_order_relaxed);
+					}
+				}
+
+				cell->data = std::move(value);
+				cell->sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+
+			/**
+			 * @brief		항목 꺼내기
+			 * @return		큐가 비어 있으면 false
+			 */
+			bool pop(T &value) {
+				cell_t *cell;
+				std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+				for (;;) {
+					cell = &cells[pos % count];
+					const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+					const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+					if (diff == 0) {
+						if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break;
+					} else if (diff < 0) {
+						return false;
+					} else {
+						pos = dequeue_pos.load(std::memory_order_relaxed);
+					}
+				}
+
+				value = std::move(cell->data);
+				cell->data = T();
+				cell->sequence.store(pos + count, std::memory_order_release);
+				return true;
+			}
+		};
+	}
+}
+
+#endif /* ITFACT_COMMON_MPMC_QUEUE_HPP */
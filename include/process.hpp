@@ -0,0 +1,100 @@
+/**
+ * @headerfile	process.hpp "process.hpp"
+ * @file	process.hpp
+ * @brief	외부 프로그램 실행
+ * @details	std::system() 대신 posix_spawn()으로 셸 없이 인수 벡터를 그대로 실행한다.\n
+ 			모델을 로드한 큰 주소 공간을 fork()로 복사하지 않으며(vfork 방식),
+ 			표준 입출력을 파이프로 연결할 수 있고 제한 시간이 지나면 프로세스 그룹 전체를 종료한다.
+ * @date	2026. 10. 18. 23:02:37
+ * @see
+ */
+#ifndef ITFACT_COMMON_PROCESS_HPP
+#define ITFACT_COMMON_PROCESS_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+#include <boost/noncopyable.hpp>
+
+namespace itfact {
+	namespace common {
+		/**
+		 * @brief	외부 프로세스
+		 */
+		class Process : private boost::noncopyable
+		{
+		public:
+			static const int PIPE_STDIN = 0x01;		///< 표준 입력을 파이프로 연결
+			static const int PIPE_STDOUT = 0x02;	///< 표준 출력을 파이프로 연결
+
+		private:
+			pid_t pid = -1;
+			int stdin_fd = -1;
+			int stdout_fd = -1;
+			int status = -1;
+
+		public:
+			Process() {};
+			~Process();
+
+			int spawn(const std::vector<std::string> &argv, const int pipes = 0);
+			int wait(const long timeout);
+			void kill();
+			void closeStdin();
+			void closeStdout();
+
+			pid_t getPid() const {return pid;};
+			int getStdin() const {return stdin_fd;};
+			int getStdout() const {return stdout_fd;};
+			int getStatus() const {return status;};
+			int getExitCode() const;
+		};
+
+		/**
+		 * @brief	상주 보조 프로세스 풀
+		 * @details	요청마다 프로그램을 실행하지 않고, 표준 입출력으로 요청을 반복 처리하는 프로세스를 재사용한다.\n
+		 			요청: <길이>\\n<데이터>, 응답: <상태>\\t<길이>\\n<데이터> (상태 0: 성공)\n
+		 			응답 형식이 맞지 않거나 시간을 초과한 프로세스는 종료하고 다음 요청에서 새로 실행한다.
+		 */
+		class CoProcessPool : private boost::noncopyable
+		{
+		private:
+			std::vector<std::string> argv;
+			std::size_t capacity;
+			long timeout;
+
+			std::mutex lock;
+			std::condition_variable cond;
+			std::vector<std::unique_ptr<Process>> idle;
+			std::size_t running = 0;
+			uint64_t requests = 0;
+			uint64_t failures = 0;
+			uint64_t spawns = 0;
+
+		public:
+			CoProcessPool(const std::vector<std::string> &argv, const std::size_t capacity, const long timeout);
+
+			int request(const std::string &input, std::string &output);
+			void stats(const std::string &prefix, std::string &result);
+
+		private:
+			CoProcessPool();
+			std::unique_ptr<Process> acquire();
+			void release(std::unique_ptr<Process> process, const bool reuse);
+			int exchange(Process *process, const std::string &input, std::string &output);
+		};
+
+		std::vector<std::string> splitCommand(const std::string &command);
+		int execute(const std::vector<std::string> &argv, const long timeout,
+					const std::string *input = NULL, std::string *output = NULL);
+		std::string toString(const std::vector<std::string> &argv);
+	}
+}
+
+#endif /* ITFACT_COMMON_PROCESS_HPP */
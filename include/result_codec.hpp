@@ -0,0 +1,60 @@
+/**
+ * @headerfile	result_codec.hpp "result_codec.hpp"
+ * @file	result_codec.hpp
+ * @brief	STT 결과 바이너리 인코딩
+ * @details	탭으로 구분된 STT 결과(cell data)를 열 단위 바이너리로 변환한다.\n
+ 			프레임 위치는 이전 단어 기준 차이값, 단어는 응답별 문자열 테이블의 색인,
+ 			신뢰도는 1/RESULT_CONFIDENCE_SCALE 단위 정수로 저장하며 LZ4 block 압축을 선택할 수 있다.\n
+ 			구성: "VRB1", flags(1byte), [압축 전 크기(varint)], 본문\n
+ 			본문: server, size, spk_node, [항목 수, (key, value)...], 문자열 테이블, 채널 수,
+ 			채널별 (단어 수, start 열, 길이 열, 단어 열, 신뢰도 열)\n
+ 			정수는 LEB128 varint이며 부호가 있는 값은 zigzag 변환한다.
+ 			항목은 텍스트 응답 헤더의 key=value (통화 분석 지표, feature 등)이며 RESULT_FIELDS인 경우에만 있다.\n
+ 			libitf_codec은 이 파일과 result_codec.cc만으로 만들어지므로 클라이언트에서 따로 링크할 수 있다.
+ * @date	2026. 10. 18. 19:48:30
+ * @see
+ */
+#ifndef ITFACT_COMMON_RESULT_CODEC_HPP
+#define ITFACT_COMMON_RESULT_CODEC_HPP
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace itfact {
+	namespace common {
+		static const float RESULT_CONFIDENCE_SCALE = 1000.0F;
+
+		enum RESULT_FLAG {
+			RESULT_LZ4 = 0x01,			///< 본문 LZ4 block 압축
+			RESULT_FIELDS = 0x02		///< 본문에 key=value 항목 있음
+		};
+
+		/// 인식 결과 단어
+		typedef struct {
+			unsigned long start;		///< 시작 프레임
+			unsigned long end;			///< 종료 프레임
+			std::string word;
+			float like;					///< 신뢰도
+		} result_cell_t;
+
+		/// gearman 응답
+		typedef struct {
+			std::string server;			///< 처리한 서버 (stt.server_name)
+			uint64_t size;				///< 녹취 데이터 크기 (bytes)
+			std::string spk_node;		///< 화자분리 워커 (빈 문자열: 사용하지 않음)
+			std::vector<std::pair<std::string, std::string>> fields;	///< 응답 헤더의 key=value 항목
+			std::vector<std::vector<result_cell_t>> channels;
+		} result_data_t;
+
+		std::size_t parseCells(const char *text, const std::size_t length, std::vector<result_cell_t> &cells);
+		void encodeResult(const result_data_t &result, std::string &output, const bool compress = false);
+		int decodeResult(const void *data, const std::size_t length, result_data_t &result);
+
+		void compressLZ4(const void *data, const std::size_t length, std::string &output);
+		int decompressLZ4(const void *data, const std::size_t length, void *output, const std::size_t output_size);
+	}
+}
+
+#endif /* ITFACT_COMMON_RESULT_CODEC_HPP */
@@ -0,0 +1,50 @@
+/**
+ * @headerfile	task_pool.hpp "task_pool.hpp"
+ * @file	task_pool.hpp
+ * @brief	작업 스레드 풀
+ * @details	하나의 Gearman 작업에 포함된 여러 항목을 나눠 처리하기 위한 고정 크기 스레드 풀
+ * @date	2026. 10. 18. 21:44:18
+ * @see
+ */
+#ifndef ITFACT_COMMON_TASK_POOL_HPP
+#define ITFACT_COMMON_TASK_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace itfact {
+	namespace common {
+		/**
+		 * @brief	고정 크기 스레드 풀
+		 */
+		class TaskPool : private boost::noncopyable
+		{
+		private:
+			std::mutex lock;
+			std::condition_variable cond;
+			std::deque<std::function<void ()>> tasks;
+			std::vector<std::thread> threads;
+			bool running = true;
+
+		public:
+			explicit TaskPool(const std::size_t count);
+			~TaskPool();
+
+			std::size_t size() const {return threads.size();};
+			std::future<int> submit(const std::function<int ()> &fn);
+
+		private:
+			void work();
+		};
+	}
+}
+
+#endif /* ITFACT_COMMON_TASK_POOL_HPP */
@@ -0,0 +1,68 @@
+/**
+ * @headerfile	topology.hpp "topology.hpp"
+ * @file	topology.hpp
+ * @brief	CPU 배치 관리
+ * @details	프로세스에 허용된 CPU를 용도별(Gearman 워커, 엔진 LB, OpenMP 등)로 겹치지 않게 나누고
+ 			스레드를 해당 CPU 집합에 고정한다.\n
+ 			같은 물리 코어의 하이퍼스레드는 같은 집합에 배정된다.
+ * @date	2026. 10. 18. 13:10:21
+ * @see		worker.hpp
+ */
+#ifndef ITFACT_COMMON_TOPOLOGY_HPP
+#define ITFACT_COMMON_TOPOLOGY_HPP
+
+#include <sched.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+namespace itfact {
+	namespace common {
+		/**
+		 * @brief	용도별 CPU 집합
+		 */
+		class Topology : private boost::noncopyable
+		{
+		private:
+			std::vector<int> cpus;		///< 허용된 CPU (물리 코어 순서)
+			std::size_t next = 0;		///< 아직 배정되지 않은 첫 번째 CPU
+			std::vector<std::pair<std::string, cpu_set_t>> sets;
+
+		public:
+			Topology();
+
+			std::size_t assign(const std::string &name, const std::size_t count = 0);
+			std::size_t assignExcept(const std::string &name, const std::vector<std::string> &excludes);
+			const cpu_set_t *getCpuSet(const std::string &name) const;
+			std::size_t getCount(const std::string &name) const;
+			std::size_t getTotal() const {return cpus.size();};
+			std::size_t getRemain() const {return cpus.size() - next;};
+			bool empty() const {return sets.empty();};
+			int bind(const std::string &name) const;
+			std::string toString() const;
+
+			static std::string toString(const cpu_set_t &set);
+		};
+
+		/**
+		 * @brief	범위 내에서만 호출 스레드의 CPU 집합을 변경
+		 * @details	엔진이나 OpenMP가 생성하는 스레드는 생성한 스레드의 CPU 집합을 상속받으므로
+		 			생성 시점에 원하는 집합으로 바꿔 두면 해당 스레드들도 같은 집합에 고정된다.
+		 */
+		class ScopedAffinity : private boost::noncopyable
+		{
+		private:
+			cpu_set_t saved;
+			bool changed = false;
+
+		public:
+			explicit ScopedAffinity(const cpu_set_t *set);
+			~ScopedAffinity();
+		};
+	}
+}
+
+#endif /* ITFACT_COMMON_TOPOLOGY_HPP */
@@ -24,6 +24,7 @@
 #include <libgearman/gearman.h>
 
 #include "configuration.hpp"
+#include "topology.hpp"
 
 namespace itfact {
 	/// Worker APIs
@@ -50,6 +51,7 @@ namespace itfact {
 			std::vector<std::thread> workers;
 			bool is_running = false;
 			common::Configuration config;
+			common::Topology topology;
 			log4cpp::Category *logger;
 
 		public:
@@ -64,6 +66,8 @@ namespace itfact {
 			const common::Configuration *getConfig() const {return &config;};
 			log4cpp::Category *getLogger() {return logger;};
 			log4cpp::Category *getLogger() const {return logger;};
+			common::Topology *getTopology() {return &topology;};
+			const common::Topology *getTopology() const {return &topology;};
 
 			unsigned long getTotalWorkers(const std::string &name);
 			bool isRunning() {return is_running;};
@@ -90,7 +94,8 @@ namespace itfact {
 
 		protected:
 			void run(const std::string name, void *context, unsigned int count,
-					 gearman_return_t (*fn)(gearman_job_st *, void *));
+					 gearman_return_t (*fn)(gearman_job_st *, void *),
+					 const std::vector<std::string> &aliases = std::vector<std::string>());
 			void join();
 
 		};
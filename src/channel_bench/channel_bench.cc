@@ -0,0 +1,251 @@
+/**
+ * @file	channel_bench.cc
+ * @brief	실시간 채널 여분 목록 경합 벤치마크
+ * @details	ChannelMap의 여분 채널 목록을 mutex + vector로 관리하던 방식과 잠금 없는 MPMC 큐로 관리하는 방식의
+ 			통화 연결 처리량을 비교한다.\n
+ 			실제 BasicChannelMap을 여분 목록만 바꾸어 두 번 사용하며, 통화마다 스레드 하나가
+ 			"acquire(FIRST) -> (hold) -> release(LAST)"를 반복한다.\n
+ 			실제 디코더(RealtimeSTT) 대신 가벼운 채널 객체를 생성하므로 채널 관리의 경합만 측정된다.
+ * @date	2026. 10. 19. 10:52:30
+ * @see		channel_map.hpp, mpmc_queue.hpp
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "channel_map.hpp"
+
+namespace po = boost::program_options;
+
+namespace {
+	/// 채널 (RealtimeSTT 대신 사용)
+	class StubChannel
+	{
+	public:
+		std::size_t number;
+		std::size_t packets = 0;
+
+		explicit StubChannel(const std::size_t number) : number(number) {}
+		void reset() {packets = 0;}
+	};
+
+	/**
+	 * @brief	mutex + vector 여분 목록 (MPMC 큐 적용 전의 ChannelMap)
+	 * @details	itfact::common::MPMCQueue와 같은 인터페이스
+	 */
+	template <typename T>
+	class MutexQueue
+	{
+	private:
+		std::mutex lock;
+		std::vector<T> items;
+		const std::size_t count;
+
+	public:
+		explicit MutexQueue(const std::size_t capacity) : count(capacity ? capacity : 1) {
+			items.reserve(count);
+		}
+
+		std::size_t size() {
+			std::lock_guard<std::mutex> guard(lock);
+			return items.size();
+		}
+
+		bool push(T &value) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (items.size() >= count)
+				return false;
+			items.push_back(std::move(value));
+			return true;
+		}
+
+		bool pop(T &value) {
+			std::lock_guard<std::mutex> guard(lock);
+			if (items.empty())
+				return false;
+			value = std::move(items.back());
+			items.pop_back();
+			return true;
+		}
+	};
+
+	typedef itfact::vr::node::BasicChannelMap<StubChannel,
+		MutexQueue<std::shared_ptr<StubChannel>>> MutexChannelMap;
+	typedef itfact::vr::node::BasicChannelMap<StubChannel> QueueChannelMap;
+
+	/// 벤치마크 설정
+	typedef struct {
+		std::size_t calls;			///< 동시 통화 수 (스레드 수)
+		std::size_t iterations;		///< 통화별 연결 횟수
+		std::size_t capacity;		///< 최대 채널 수
+		std::size_t spare_size;		///< 여분 채널 수
+		std::size_t shards;
+		std::chrono::microseconds hold;	///< 채널을 사용하는 시간 (0: 바로 반환)
+	} bench_option_t;
+
+	/// 측정 결과
+	typedef struct {
+		double seconds;
+		std::size_t setups;
+		std::size_t rejected;
+		double p50;				///< acquire 지연 시간 (us)
+		double p99;
+	} bench_result_t;
+}
+
+/**
+ * @brief		정렬된 값에서 백분위 값을 구함
+ */
+static double percentile(std::vector<double> &values, const double ratio) {
+	if (values.empty())
+		return 0;
+	const std::size_t idx = std::min(values.size() - 1, static_cast<std::size_t>(ratio * values.size()));
+	std::nth_element(values.begin(), values.begin() + idx, values.end());
+	return values[idx];
+}
+
+/**
+ * @brief		통화 연결 반복
+ * @details		모든 스레드를 만든 후 동시에 시작하며, acquire 지연 시간은 sample번에 한 번 기록한다.
+ * @param[in]	option		벤치마크 설정
+ */
+template <typename MAP>
+static bench_result_t measure(const bench_option_t &option) {
+	static const std::size_t sample = 16;
+	MAP channels([](const std::size_t number) {return std::make_shared<StubChannel>(number);},
+				 option.shards, option.capacity, option.spare_size, std::chrono::seconds(0));
+
+	const std::size_t calls = option.calls;
+	const std::size_t iterations = option.iterations;
+	std::vector<std::vector<double>> latencies(calls);
+	std::atomic<std::size_t> rejected(0);
+	std::atomic<std::size_t> ready(0);
+	std::atomic<bool> start(false);
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < calls; ++i) {
+		threads.emplace_back([&, i] {
+			latencies[i].reserve(iterations / sample + 1);
+			++ready;
+			while (!start.load())
+				std::this_thread::yield();
+
+			const std::string call_id("call-" + std::to_string(i));
+			for (std::size_t k = 0; k < iterations; ++k) {
+				const auto begin = std::chrono::steady_clock::now();
+				std::shared_ptr<StubChannel> node = channels.acquire(call_id);
+				if (k % sample == 0)
+					latencies[i].push_back(std::chrono::duration<double, std::micro>(
+						std::chrono::steady_clock::now() - begin).count());
+				if (!node) {
+					++rejected;
+					continue;
+				}
+
+				++node->packets;
+				if (option.hold.count() > 0)
+					std::this_thread::sleep_for(option.hold);
+				channels.release(call_id, node, true);
+			}
+		});
+	}
+
+	while (ready.load() < calls)
+		std::this_thread::yield();
+	const auto begin = std::chrono::steady_clock::now();
+	start = true;
+	for (auto &&thread : threads)
+		thread.join();
+
+	bench_result_t result;
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	result.rejected = rejected.load();
+	result.setups = calls * iterations - result.rejected;
+
+	std::vector<double> values;
+	for (auto &&list : latencies)
+		values.insert(values.end(), list.begin(), list.end());
+	result.p50 = percentile(values, 0.5);
+	result.p99 = percentile(values, 0.99);
+	return result;
+}
+
+static void report(const char *name, const std::size_t calls, const bench_result_t &result) {
+	std::printf("%-6s calls: %5lu, setups: %9lu, %10.0f setups/s, acquire p50: %8.2f us, p99: %8.2f us, "
+				"rejected: %lu\n", name, calls, result.setups, result.setups / result.seconds,
+				result.p50, result.p99, result.rejected);
+}
+
+int main(const int argc, char const *argv[]) {
+	std::string call_list;
+	std::size_t iterations, capacity, spare_size, shards, repeat;
+	long hold_us;
+
+	po::options_description desc("Usage");
+	desc.add_options()
+		("help,h", "Show this help")
+		("calls,c", po::value<std::string>(&call_list)->default_value("200,256,512"),
+		 "Concurrent calls (comma separated)")
+		("iterations,n", po::value<std::size_t>(&iterations)->default_value(10000), "Call setups per call")
+		("capacity", po::value<std::size_t>(&capacity)->default_value(0),
+		 "Maximum channels (0: same as calls, like realtime.max_channels under USE_REALTIME_POOL)")
+		("spare", po::value<std::size_t>(&spare_size)->default_value(0),
+		 "Spare channels kept (0: same as capacity)")
+		("shards", po::value<std::size_t>(&shards)->default_value(16), "Channel map shards (realtime.channel_shards)")
+		("hold", po::value<long>(&hold_us)->default_value(0), "Microseconds a call keeps its channel")
+		("repeat,r", po::value<std::size_t>(&repeat)->default_value(3), "Runs per implementation");
+
+	po::variables_map vm;
+	std::vector<std::size_t> call_counts;
+	try {
+		po::store(po::parse_command_line(argc, argv, desc), vm);
+		po::notify(vm);
+		if (vm.count("help")) {
+			std::cout << desc << std::endl;
+			return EXIT_SUCCESS;
+		}
+
+		for (std::size_t pos = 0; pos < call_list.size();) {
+			std::size_t end = call_list.find(',', pos);
+			if (end == std::string::npos)
+				end = call_list.size();
+			if (end > pos)
+				call_counts.push_back(std::stoul(call_list.substr(pos, end - pos)));
+			pos = end + 1;
+		}
+	} catch (std::exception &e) {
+		std::fprintf(stderr, "%s\n", e.what());
+		return EXIT_FAILURE;
+	}
+
+	std::printf("hardware threads: %u, iterations: %lu, hold: %ld us\n",
+				std::thread::hardware_concurrency(), iterations, hold_us);
+	for (auto &&calls : call_counts) {
+		if (calls == 0)
+			continue;
+		bench_option_t option;
+		option.calls = calls;
+		option.iterations = iterations;
+		option.capacity = capacity ? capacity : calls;
+		option.spare_size = spare_size ? spare_size : option.capacity;
+		option.shards = shards;
+		option.hold = std::chrono::microseconds(hold_us);
+		for (std::size_t r = 0; r < repeat; ++r) {
+			report("mutex", calls, measure<MutexChannelMap>(option));
+			report("mpmc", calls, measure<QueueChannelMap>(option));
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,443 @@
+/**
+ * @file	result_codec.cc
+ * @brief	STT 결과 바이너리 인코딩
+ * @details	LZ4는 block format만 구현하며 (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+ 			표준 LZ4 라이브러리의 LZ4_decompress_safe()로도 해제할 수 있다.
+ * @date	2026. 10. 18. 19:48:30
+ * @see		result_codec.hpp
+ */
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+#include "result_codec.hpp"
+
+using namespace itfact::common;
+
+static const char RESULT_MAGIC[4] = {'V', 'R', 'B', '1'};
+
+static inline void putVarint(std::string &output, uint64_t value) {
+	while (value >= 0x80) {
+		output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	output.push_back(static_cast<char>(value));
+}
+
+static inline void putSigned(std::string &output, const int64_t value) {
+	putVarint(output, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+static inline void putString(std::string &output, const std::string &value) {
+	putVarint(output, value.size());
+	output.append(value);
+}
+
+namespace {
+/// 바이너리 읽기 (범위를 벗어나면 이후 읽기는 모두 실패)
+class Reader {
+private:
+	const uint8_t *p;
+	const uint8_t *end;
+
+public:
+	Reader(const uint8_t *data, const std::size_t length) : p(data), end(data + length) {};
+
+	bool good() const {return p != NULL;};
+	bool eof() const {return p == end;};
+	const uint8_t *position() const {return p;};
+
+	uint64_t varint() {
+		uint64_t value = 0;
+		for (int shift = 0; p && shift < 64; shift += 7) {
+			if (p == end)
+				break;
+			uint8_t byte = *p++;
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+				return value;
+		}
+		p = NULL;
+		return 0;
+	}
+
+	int64_t zigzag() {
+		uint64_t value = varint();
+		return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+	}
+
+	bool string(std::string &value) {
+		uint64_t length = varint();
+		if (!p || length > static_cast<uint64_t>(end - p)) {
+			p = NULL;
+			return false;
+		}
+		value.assign(reinterpret_cast<const char *>(p), static_cast<std::size_t>(length));
+		p += length;
+		return true;
+	}
+};
+}
+
+/**
+ * @brief		탭으로 구분된 결과를 단어 목록으로 변환
+ * @details		"start\tend\tword\tlikelihood" 형식이 아닌 줄은 무시한다.
+ * @date		2026. 10. 18. 19:55:14
+ * @param[in]	text	STT 결과
+ * @param[in]	length	STT 결과 길이
+ * @param[out]	cells	단어 목록 (뒤에 추가)
+ * @return		추가된 단어 수
+ */
+std::size_t itfact::common::parseCells(const char *text, const std::size_t length,
+									   std::vector<result_cell_t> &cells) {
+	const std::size_t count = cells.size();
+	const char *end = text + length;
+	const char *next;
+	for (const char *line = text; line < end; line = next) {
+		const char *eol = static_cast<const char *>(std::memchr(line, '\n', end - line));
+		if (eol == NULL)
+			eol = end;
+		next = eol + 1;
+
+		const char *fields[4];
+		std::size_t lengths[4];
+		std::size_t n = 0;
+		for (const char *p = line; n < 4 && p <= eol; ++n) {
+			const char *tab = static_cast<const char *>(std::memchr(p, '\t', eol - p));
+			if (tab == NULL || n == 3)
+				tab = eol;
+			fields[n] = p;
+			lengths[n] = static_cast<std::size_t>(tab - p);
+			p = tab + 1;
+		}
+		if (n < 4 || lengths[0] == 0 || lengths[1] == 0 || lengths[3] == 0)
+			continue;
+
+		result_cell_t cell;
+		char *stop;
+		cell.start = std::strtoul(fields[0], &stop, 10);
+		if (stop != fields[0] + lengths[0])
+			continue;
+		cell.end = std::strtoul(fields[1], &stop, 10);
+		if (stop != fields[1] + lengths[1])
+			continue;
+		cell.like = std::strtof(fields[3], &stop);
+		if (stop == fields[3])
+			continue;
+		cell.word.assign(fields[2], lengths[2]);
+		cells.push_back(cell);
+	}
+
+	return cells.size() - count;
+}
+
+/**
+ * @brief		바이너리 인코딩
+ * @date		2026. 10. 18. 20:02:41
+ * @param[in]	result		gearman 응답
+ * @param[out]	output		인코딩 결과 (뒤에 추가)
+ * @param[in]	compress	LZ4 압축 여부
+ */
+void itfact::common::encodeResult(const result_data_t &result, std::string &output, const bool compress) {
+	std::string body;
+	putString(body, result.server);
+	putVarint(body, result.size);
+	putString(body, result.spk_node);
+	if (!result.fields.empty()) {
+		putVarint(body, result.fields.size());
+		for (auto &&field : result.fields) {
+			putString(body, field.first);
+			putString(body, field.second);
+		}
+	}
+
+	// 문자열 테이블
+	std::unordered_map<std::string, uint64_t> table;
+	std::vector<const std::string *> words;
+	for (auto &&channel : result.channels) {
+		for (auto &&cell : channel) {
+			if (table.emplace(cell.word, words.size()).second)
+				words.push_back(&cell.word);
+		}
+	}
+	putVarint(body, words.size());
+	for (auto &&word : words)
+		putString(body, *word);
+
+	putVarint(body, result.channels.size());
+	for (auto &&channel : result.channels) {
+		putVarint(body, channel.size());
+
+		unsigned long prev_end = 0;
+		for (auto &&cell : channel) {
+			putSigned(body, static_cast<int64_t>(cell.start) - static_cast<int64_t>(prev_end));
+			prev_end = cell.end;
+		}
+		for (auto &&cell : channel)
+			putSigned(body, static_cast<int64_t>(cell.end) - static_cast<int64_t>(cell.start));
+		for (auto &&cell : channel)
+			putVarint(body, table[cell.word]);
+		for (auto &&cell : channel) {
+			double like = std::round(static_cast<double>(cell.like) * RESULT_CONFIDENCE_SCALE);
+			if (!(like > INT32_MIN))
+				like = INT32_MIN;
+			else if (like > INT32_MAX)
+				like = INT32_MAX;
+			putSigned(body, static_cast<int64_t>(like));
+		}
+	}
+
+	output.append(RESULT_MAGIC, sizeof(RESULT_MAGIC));
+	const uint8_t flags = static_cast<uint8_t>(result.fields.empty() ? 0 : RESULT_FIELDS);
+	if (compress) {
+		output.push_back(static_cast<char>(flags | RESULT_LZ4));
+		putVarint(output, body.size());
+		compressLZ4(body.data(), body.size(), output);
+	} else {
+		output.push_back(static_cast<char>(flags));
+		output.append(body);
+	}
+}
+
+/**
+ * @brief		바이너리 디코딩
+ * @date		2026. 10. 18. 20:10:27
+ * @param[in]	data	encodeResult() 결과
+ * @param[in]	length	데이터 길이
+ * @param[out]	result	gearman 응답
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int itfact::common::decodeResult(const void *data, const std::size_t length, result_data_t &result) {
+	const uint8_t *bytes = static_cast<const uint8_t *>(data);
+	if (length < sizeof(RESULT_MAGIC) + 1 || std::memcmp(bytes, RESULT_MAGIC, sizeof(RESULT_MAGIC)) != 0)
+		return EXIT_FAILURE;
+
+	const uint8_t flags = bytes[sizeof(RESULT_MAGIC)];
+	if (flags & ~(RESULT_LZ4 | RESULT_FIELDS))
+		return EXIT_FAILURE;
+	Reader header(bytes + sizeof(RESULT_MAGIC) + 1, length - sizeof(RESULT_MAGIC) - 1);
+	const uint8_t *body = bytes + sizeof(RESULT_MAGIC) + 1;
+	std::size_t body_size = length - sizeof(RESULT_MAGIC) - 1;
+
+	std::vector<uint8_t> buffer;
+	if (flags & RESULT_LZ4) {
+		uint64_t raw_size = header.varint();
+		if (!header.good() || raw_size > (static_cast<uint64_t>(body_size) << 8))
+			return EXIT_FAILURE;
+
+		const std::size_t varint_size = static_cast<std::size_t>(header.position() - body);
+		buffer.resize(static_cast<std::size_t>(raw_size));
+		if (decompressLZ4(body + varint_size, body_size - varint_size,
+						  buffer.data(), buffer.size()) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+		body = buffer.data();
+		body_size = buffer.size();
+	}
+
+	Reader reader(body, body_size);
+	reader.string(result.server);
+	result.size = reader.varint();
+	reader.string(result.spk_node);
+
+	result.fields.clear();
+	if (flags & RESULT_FIELDS) {
+		uint64_t nfields = reader.varint();
+		if (!reader.good() || nfields > body_size)
+			return EXIT_FAILURE;
+		result.fields.resize(static_cast<std::size_t>(nfields));
+		for (auto &&field : result.fields) {
+			if (!reader.string(field.first) || !reader.string(field.second))
+				return EXIT_FAILURE;
+		}
+	}
+
+	uint64_t nwords = reader.varint();
+	if (!reader.good() || nwords > body_size)
+		return EXIT_FAILURE;
+	std::vector<std::string> words(static_cast<std::size_t>(nwords));
+	for (auto &&word : words) {
+		if (!reader.string(word))
+			return EXIT_FAILURE;
+	}
+
+	uint64_t nchannels = reader.varint();
+	if (!reader.good() || nchannels > body_size)
+		return EXIT_FAILURE;
+	result.channels.assign(static_cast<std::size_t>(nchannels), std::vector<result_cell_t>());
+	for (auto &&channel : result.channels) {
+		uint64_t count = reader.varint();
+		if (!reader.good() || count > body_size)
+			return EXIT_FAILURE;
+		channel.resize(static_cast<std::size_t>(count));
+
+		// start 열은 이전 단어의 end 기준
+		std::vector<int64_t> gaps(channel.size());
+		for (auto &&gap : gaps)
+			gap = reader.zigzag();
+		int64_t prev_end = 0;
+		for (std::size_t i = 0; i < channel.size(); ++i) {
+			const int64_t start = prev_end + gaps[i];
+			prev_end = start + reader.zigzag();
+			channel[i].start = static_cast<unsigned long>(start);
+			channel[i].end = static_cast<unsigned long>(prev_end);
+		}
+		for (auto &&cell : channel) {
+			uint64_t id = reader.varint();
+			if (id >= words.size())
+				return EXIT_FAILURE;
+			cell.word = words[static_cast<std::size_t>(id)];
+		}
+		for (auto &&cell : channel)
+			cell.like = static_cast<float>(reader.zigzag()) / RESULT_CONFIDENCE_SCALE;
+	}
+
+	return reader.good() && reader.eof() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static const std::size_t LZ4_MIN_MATCH = 4;
+static const std::size_t LZ4_MF_LIMIT = 12;		///< 마지막 match는 블록 끝에서 12byte 이전에 시작
+static const std::size_t LZ4_LAST_LITERALS = 5;	///< 마지막 5byte는 항상 literal
+static const int LZ4_HASH_LOG = 12;
+
+static inline uint32_t read32(const uint8_t *p) {
+	uint32_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static inline void putLength(std::string &output, std::size_t length) {
+	for (; length >= 255; length -= 255)
+		output.push_back(static_cast<char>(255));
+	output.push_back(static_cast<char>(length));
+}
+
+static inline void putSequence(std::string &output, const uint8_t *literals, const std::size_t nliterals,
+							   const std::size_t offset, const std::size_t match_length) {
+	const std::size_t match = match_length - LZ4_MIN_MATCH;
+	uint8_t token = static_cast<uint8_t>((nliterals < 15 ? nliterals : 15) << 4);
+	if (match_length > 0)
+		token |= static_cast<uint8_t>(match < 15 ? match : 15);
+	output.push_back(static_cast<char>(token));
+	if (nliterals >= 15)
+		putLength(output, nliterals - 15);
+	output.append(reinterpret_cast<const char *>(literals), nliterals);
+
+	if (match_length > 0) {
+		output.push_back(static_cast<char>(offset & 0xFF));
+		output.push_back(static_cast<char>(offset >> 8));
+		if (match >= 15)
+			putLength(output, match - 15);
+	}
+}
+
+/**
+ * @brief		LZ4 block 압축
+ * @details		해시 테이블로 4byte 일치를 찾는 단순한 greedy 방식이다.
+ * @date		2026. 10. 18. 20:21:36
+ * @param[in]	data	원본 데이터
+ * @param[in]	length	원본 데이터 길이
+ * @param[out]	output	압축 결과 (뒤에 추가)
+ */
+void itfact::common::compressLZ4(const void *data, const std::size_t length, std::string &output) {
+	const uint8_t *src = static_cast<const uint8_t *>(data);
+	std::size_t anchor = 0;
+
+	if (length > LZ4_MF_LIMIT) {
+		std::vector<std::size_t> table(static_cast<std::size_t>(1) << LZ4_HASH_LOG, SIZE_MAX);
+		const std::size_t match_limit = length - LZ4_MF_LIMIT;
+		const std::size_t end_limit = length - LZ4_LAST_LITERALS;
+
+		for (std::size_t ip = 0; ip < match_limit;) {
+			const uint32_t sequence = read32(src + ip);
+			const uint32_t hash = (sequence * 2654435761U) >> (32 - LZ4_HASH_LOG);
+			const std::size_t ref = table[hash];
+			table[hash] = ip;
+
+			if (ref == SIZE_MAX || ip - ref > 0xFFFF || read32(src + ref) != sequence) {
+				++ip;
+				continue;
+			}
+
+			std::size_t match_length = LZ4_MIN_MATCH;
+			while (ip + match_length < end_limit && src[ref + match_length] == src[ip + match_length])
+				++match_length;
+
+			putSequence(output, src + anchor, ip - anchor, ip - ref, match_length);
+			ip += match_length;
+			anchor = ip;
+		}
+	}
+
+	putSequence(output, src + anchor, length - anchor, 0, 0);
+}
+
+/**
+ * @brief		LZ4 block 해제
+ * @param[in]	data		압축 데이터
+ * @param[in]	length		압축 데이터 길이
+ * @param[out]	output		해제 결과
+ * @param[in]	output_size	원본 데이터 길이
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise (손상된 데이터이거나 길이가 다른 경우), a EXIT_FAILURE is returned.
+ */
+int itfact::common::decompressLZ4(const void *data, const std::size_t length,
+								  void *output, const std::size_t output_size) {
+	const uint8_t *ip = static_cast<const uint8_t *>(data);
+	const uint8_t *const ip_end = ip + length;
+	uint8_t *const dst = static_cast<uint8_t *>(output);
+	std::size_t op = 0;
+
+	while (ip < ip_end) {
+		const uint8_t token = *ip++;
+
+		std::size_t nliterals = token >> 4;
+		if (nliterals == 15) {
+			uint8_t byte;
+			do {
+				if (ip == ip_end)
+					return EXIT_FAILURE;
+				byte = *ip++;
+				nliterals += byte;
+			} while (byte == 255);
+		}
+		if (nliterals > static_cast<std::size_t>(ip_end - ip) || nliterals > output_size - op)
+			return EXIT_FAILURE;
+		std::memcpy(dst + op, ip, nliterals);
+		ip += nliterals;
+		op += nliterals;
+
+		// 마지막 sequence는 literal만 있음
+		if (ip == ip_end)
+			break;
+
+		if (ip_end - ip < 2)
+			return EXIT_FAILURE;
+		const std::size_t offset = ip[0] | (static_cast<std::size_t>(ip[1]) << 8);
+		ip += 2;
+		if (offset == 0 || offset > op)
+			return EXIT_FAILURE;
+
+		std::size_t match_length = (token & 0x0F) + LZ4_MIN_MATCH;
+		if ((token & 0x0F) == 15) {
+			uint8_t byte;
+			do {
+				if (ip == ip_end)
+					return EXIT_FAILURE;
+				byte = *ip++;
+				match_length += byte;
+			} while (byte == 255);
+		}
+		if (match_length > output_size - op)
+			return EXIT_FAILURE;
+
+		// 겹치는 구간이 있을 수 있으므로 1byte씩 복사
+		const uint8_t *match = dst + op - offset;
+		for (std::size_t i = 0; i < match_length; ++i)
+			dst[op + i] = match[i];
+		op += match_length;
+	}
+
+	return op == output_size ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file	codec_test.cc
+ * @brief	STT 결과 바이너리 인코딩 검사
+ * @details	libitf_codec만 링크하여 encodeResult()와 decodeResult()의 왕복 결과를 확인한다.\n
+ 			비압축/LZ4 본문, key=value 항목, 잘린 입력과 알 수 없는 flags를 검사하며
+ 			실패한 항목이 있으면 EXIT_FAILURE로 끝난다.
+ * @date	2026. 10. 19. 11:41:20
+ * @see		result_codec.hpp
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "result_codec.hpp"
+
+using namespace itfact::common;
+
+static int failures = 0;
+
+static void check(const bool condition, const char *name) {
+	if (!condition) {
+		std::printf("FAIL\t%s\n", name);
+		++failures;
+	}
+}
+
+/**
+ * @brief		두 결과가 같은지 비교
+ * @details		신뢰도는 1/RESULT_CONFIDENCE_SCALE 단위로 양자화되므로 반 단위까지 허용한다.
+ */
+static bool same(const result_data_t &a, const result_data_t &b) {
+	if (a.server != b.server || a.size != b.size || a.spk_node != b.spk_node || a.fields != b.fields ||
+		a.channels.size() != b.channels.size())
+		return false;
+	for (std::size_t ch = 0; ch < a.channels.size(); ++ch) {
+		if (a.channels[ch].size() != b.channels[ch].size())
+			return false;
+		for (std::size_t i = 0; i < a.channels[ch].size(); ++i) {
+			const result_cell_t &x = a.channels[ch][i];
+			const result_cell_t &y = b.channels[ch][i];
+			if (x.start != y.start || x.end != y.end || x.word != y.word ||
+				std::fabs(x.like - y.like) > 0.5F / RESULT_CONFIDENCE_SCALE + 1e-6F)
+				return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief		왕복 및 잘린 입력 검사
+ */
+static void roundTrip(const result_data_t &result, const bool compress, const char *name) {
+	std::string encoded;
+	encodeResult(result, encoded, compress);
+
+	result_data_t decoded;
+	const bool decodable = decodeResult(encoded.data(), encoded.size(), decoded) == EXIT_SUCCESS;
+	check(decodable, name);
+	check(decodable && same(result, decoded), name);
+	check(((encoded[4] & RESULT_LZ4) != 0) == compress, name);
+	check(((encoded[4] & RESULT_FIELDS) != 0) == !result.fields.empty(), name);
+
+	// 모든 길이로 자른 입력은 실패해야 함
+	std::size_t accepted = 0;
+	for (std::size_t length = 0; length < encoded.size(); ++length) {
+		result_data_t partial;
+		if (decodeResult(encoded.data(), length, partial) == EXIT_SUCCESS)
+			++accepted;
+	}
+	check(accepted == 0, name);
+
+	// 뒤에 붙은 데이터도 실패
+	std::string extended(encoded);
+	extended.push_back('\0');
+	check(decodeResult(extended.data(), extended.size(), decoded) != EXIT_SUCCESS, name);
+
+	std::printf("%s\t%lu bytes\n", name, encoded.size());
+}
+
+int main() {
+	const char *text =
+		"0\t35\t<s>\t0.000000\n"
+		"35\t80\t안녕하세요\t0.912345\n"
+		"80\t112\t상담원\t0.750000\n"
+		"140\t190\t입니다\t-1.250000\n"
+		"190\t200\t</s>\t0.000000\n";
+
+	result_data_t result;
+	result.server = "vr_1";
+	result.size = 1234567;
+	result.channels.resize(2);
+	check(parseCells(text, std::char_traits<char>::length(text), result.channels[0]) == 5, "parseCells");
+	check(parseCells("garbage\n1\t2\n", 12, result.channels[1]) == 0, "parseCells (invalid lines)");
+
+	roundTrip(result, false, "plain");
+	roundTrip(result, true, "lz4");
+
+	// 통화 분석 지표와 feature (vr_stt의 "\tkey=value" 헤더 항목)
+	result.spk_node = "vr_spk";
+	result.fields.push_back(std::make_pair("duration", "12.345"));
+	result.fields.push_back(std::make_pair("talk", "0.61"));
+	result.fields.push_back(std::make_pair("feature", "a.feat,b.feat"));
+	roundTrip(result, false, "plain+fields");
+	roundTrip(result, true, "lz4+fields");
+
+	// 단어가 반복되는 긴 결과는 LZ4 본문이 더 작아야 함
+	result_data_t large;
+	large.server = "vr_1";
+	large.size = 0;
+	large.channels.resize(1);
+	for (unsigned long i = 0; i < 5000; ++i) {
+		result_cell_t cell = {i * 20, i * 20 + 15, (i % 3) ? "네" : "고객님", 0.5F};
+		large.channels[0].push_back(cell);
+	}
+	std::string plain, compressed;
+	encodeResult(large, plain, false);
+	encodeResult(large, compressed, true);
+	check(compressed.size() < plain.size(), "lz4 ratio");
+	roundTrip(large, true, "lz4 (large)");
+
+	// 빈 결과
+	result_data_t empty;
+	empty.size = 0;
+	roundTrip(empty, false, "empty");
+	roundTrip(empty, true, "empty lz4");
+
+	// 알 수 없는 flags와 magic
+	std::string encoded;
+	encodeResult(result, encoded, false);
+	result_data_t decoded;
+	std::string unknown(encoded);
+	unknown[4] = static_cast<char>(unknown[4] | 0x80);
+	check(decodeResult(unknown.data(), unknown.size(), decoded) != EXIT_SUCCESS, "unknown flags");
+	std::string magic(encoded);
+	magic[3] = '2';
+	check(decodeResult(magic.data(), magic.size(), decoded) != EXIT_SUCCESS, "magic");
+
+	std::printf("%s\n", failures ? "FAILED" : "OK");
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
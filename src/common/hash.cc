@@ -0,0 +1,106 @@
+/**
+ * @file	hash.cc
+ * @brief	해시 함수
+ * @details	MurmurHash3 x64_128 (Austin Appleby, public domain)
+ * @date	2026. 10. 18. 15:26:40
+ * @see		hash.hpp
+ */
+#include <cstdio>
+#include <cstring>
+
+#include "hash.hpp"
+
+using namespace itfact::common;
+
+static inline uint64_t rotl64(const uint64_t x, const int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fmix64(uint64_t k) {
+	k ^= k >> 33;
+	k *= 0xff51afd7ed558ccdULL;
+	k ^= k >> 33;
+	k *= 0xc4ceb9fe1a85ec53ULL;
+	k ^= k >> 33;
+	return k;
+}
+
+/**
+ * @brief		128bit 해시 값 계산
+ * @date		2026. 10. 18. 15:29:12
+ * @param[in]	data	데이터
+ * @param[in]	len		데이터 길이 (bytes)
+ * @param[in]	seed	시드
+ * @return		해시 값
+ */
+hash128_t itfact::common::hash128(const void *data, const std::size_t len, const uint64_t seed) {
+	const uint8_t *bytes = static_cast<const uint8_t *>(data);
+	const std::size_t nblocks = len / 16;
+	const uint64_t c1 = 0x87c37b91114253d5ULL;
+	const uint64_t c2 = 0x4cf5ad432745937fULL;
+
+	uint64_t h1 = seed;
+	uint64_t h2 = seed;
+
+	for (std::size_t i = 0; i < nblocks; ++i) {
+		uint64_t k1, k2;
+		std::memcpy(&k1, bytes + i * 16, sizeof(k1));
+		std::memcpy(&k2, bytes + i * 16 + 8, sizeof(k2));
+
+		k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+		h1 = rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+		k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+		h2 = rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+	}
+
+	const uint8_t *tail = bytes + nblocks * 16;
+	uint64_t k1 = 0;
+	uint64_t k2 = 0;
+
+	switch (len & 15) {
+	case 15: k2 ^= static_cast<uint64_t>(tail[14]) << 48;
+	case 14: k2 ^= static_cast<uint64_t>(tail[13]) << 40;
+	case 13: k2 ^= static_cast<uint64_t>(tail[12]) << 32;
+	case 12: k2 ^= static_cast<uint64_t>(tail[11]) << 24;
+	case 11: k2 ^= static_cast<uint64_t>(tail[10]) << 16;
+	case 10: k2 ^= static_cast<uint64_t>(tail[ 9]) << 8;
+	case  9: k2 ^= static_cast<uint64_t>(tail[ 8]) << 0;
+		k2 *= c2; k2 = rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+
+	case  8: k1 ^= static_cast<uint64_t>(tail[ 7]) << 56;
+	case  7: k1 ^= static_cast<uint64_t>(tail[ 6]) << 48;
+	case  6: k1 ^= static_cast<uint64_t>(tail[ 5]) << 40;
+	case  5: k1 ^= static_cast<uint64_t>(tail[ 4]) << 32;
+	case  4: k1 ^= static_cast<uint64_t>(tail[ 3]) << 24;
+	case  3: k1 ^= static_cast<uint64_t>(tail[ 2]) << 16;
+	case  2: k1 ^= static_cast<uint64_t>(tail[ 1]) << 8;
+	case  1: k1 ^= static_cast<uint64_t>(tail[ 0]) << 0;
+		k1 *= c1; k1 = rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+	}
+
+	h1 ^= static_cast<uint64_t>(len);
+	h2 ^= static_cast<uint64_t>(len);
+
+	h1 += h2;
+	h2 += h1;
+
+	h1 = fmix64(h1);
+	h2 = fmix64(h2);
+
+	h1 += h2;
+	h2 += h1;
+
+	hash128_t hash = {h1, h2};
+	return hash;
+}
+
+/**
+ * @brief		해시 값을 32자리 16진수 문자열로 변환
+ */
+std::string itfact::common::toHex(const hash128_t &hash) {
+	char buffer[33];
+	std::snprintf(buffer, sizeof(buffer), "%016llx%016llx",
+				  static_cast<unsigned long long>(hash.h1), static_cast<unsigned long long>(hash.h2));
+	return std::string(buffer, 32);
+}
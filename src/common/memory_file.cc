@@ -0,0 +1,105 @@
+/**
+ * @file	memory_file.cc
+ * @brief	메모리 파일
+ * @details
+ * @date	2026. 10. 18. 21:32:06
+ * @see		memory_file.hpp
+ */
+#include <cerrno>
+#include <cstdlib>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include "memory_file.hpp"
+
+using namespace itfact::common;
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC		0x0001U
+#endif
+
+/**
+ * @brief		익명 파일 생성
+ * @details		생성에 실패하면 isOpen()이 false를 반환한다.
+ * @date		2026. 10. 18. 21:35:40
+ * @param[in]	name		파일 이름 (/proc/self/fd의 링크 표시용)
+ * @param[in]	tmp_path	memfd_create()를 사용할 수 없을 때 사용할 임시 디렉터리
+ */
+MemoryFile::MemoryFile(const std::string &name, const std::string &tmp_path) {
+#ifdef SYS_memfd_create
+	fd = static_cast<int>(syscall(SYS_memfd_create, name.c_str(), MFD_CLOEXEC));
+#endif
+	if (fd < 0) {
+		std::string pattern(tmp_path);
+		if (pattern.empty() || pattern.at(pattern.size() - 1) != '/')
+			pattern.push_back('/');
+		pattern.append(name).append(".XXXXXX");
+
+		std::vector<char> buffer(pattern.begin(), pattern.end());
+		buffer.push_back('\0');
+		fd = mkstemp(buffer.data());
+		if (fd < 0)
+			return;
+		unlink(buffer.data());
+		fcntl(fd, F_SETFD, FD_CLOEXEC);
+	}
+
+	pathname = "/proc/self/fd/";
+	pathname.append(std::to_string(fd));
+}
+
+MemoryFile::~MemoryFile() {
+	if (fd >= 0)
+		close(fd);
+}
+
+/**
+ * @brief		내용을 data로 교체
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int MemoryFile::write(const void *data, const std::size_t size) {
+	if (fd < 0 || ftruncate(fd, 0) != 0)
+		return EXIT_FAILURE;
+
+	const char *p = static_cast<const char *>(data);
+	for (std::size_t offset = 0; offset < size;) {
+		ssize_t wsize = pwrite(fd, p + offset, size - offset, static_cast<off_t>(offset));
+		if (wsize < 0 && errno == EINTR)
+			continue;
+		if (wsize <= 0)
+			return EXIT_FAILURE;
+		offset += static_cast<std::size_t>(wsize);
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		전체 내용을 data 뒤에 추가
+ * @details		getPath()로 다시 열어 기록한 내용도 읽을 수 있다.
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int MemoryFile::read(std::string &data) const {
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0)
+		return EXIT_FAILURE;
+
+	const std::size_t base = data.size();
+	data.resize(base + static_cast<std::size_t>(st.st_size));
+	for (std::size_t offset = 0; offset < static_cast<std::size_t>(st.st_size);) {
+		ssize_t rsize = pread(fd, &data[base + offset], st.st_size - offset, static_cast<off_t>(offset));
+		if (rsize < 0 && errno == EINTR)
+			continue;
+		if (rsize <= 0) {
+			data.resize(base + offset);
+			return rsize == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		offset += static_cast<std::size_t>(rsize);
+	}
+	return EXIT_SUCCESS;
+}
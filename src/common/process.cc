@@ -0,0 +1,471 @@
+/**
+ * @file	process.cc
+ * @brief	외부 프로그램 실행
+ * @details
+ * @date	2026. 10. 18. 23:02:37
+ * @see		process.hpp
+ */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE		// POSIX_SPAWN_USEVFORK
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/algorithm/string/split.hpp>
+
+#include "process.hpp"
+
+extern char **environ;
+
+using namespace itfact::common;
+
+/// 종료 확인 주기의 최대값 (ms)
+static const int MAX_POLL_INTERVAL = 50;
+
+static inline void __close(int &fd) {
+	if (fd >= 0)
+		close(fd);
+	fd = -1;
+}
+
+static inline long __elapsed(const std::chrono::steady_clock::time_point &start) {
+	return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - start).count());
+}
+
+namespace {
+	/**
+	 * @brief	자식이 먼저 종료된 경우 파이프 쓰기에서 SIGPIPE 대신 EPIPE를 받도록 현재 스레드에서 차단
+	 */
+	class SigpipeGuard
+	{
+	private:
+		sigset_t pipe_mask;
+		sigset_t old_mask;
+
+	public:
+		SigpipeGuard() {
+			sigemptyset(&pipe_mask);
+			sigaddset(&pipe_mask, SIGPIPE);
+			pthread_sigmask(SIG_BLOCK, &pipe_mask, &old_mask);
+		}
+		~SigpipeGuard() {
+			// 차단 중 발생한 SIGPIPE 제거
+			struct timespec zero = {0, 0};
+			while (sigtimedwait(&pipe_mask, NULL, &zero) > 0)
+				;
+			pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+		}
+	};
+}
+
+/**
+ * @brief		실행 중이면 종료
+ */
+Process::~Process() {
+	kill();
+	__close(stdin_fd);
+	__close(stdout_fd);
+}
+
+/**
+ * @brief		프로그램 실행
+ * @details		argv[0]에 '/'가 없으면 PATH에서 찾는다.
+ 			파이프로 연결하지 않은 표준 입력은 /dev/null, 표준 출력과 오류는 현재 프로세스와 같다.
+ 			자식은 새 프로세스 그룹으로 실행하며 시그널 설정은 기본값으로 되돌린다.
+ * @date		2026. 10. 18. 23:08:14
+ * @param[in]	argv	프로그램과 인수
+ * @param[in]	pipes	PIPE_STDIN, PIPE_STDOUT의 조합
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a positive error code is returned indicating what went wrong.
+ */
+int Process::spawn(const std::vector<std::string> &argv, const int pipes) {
+	if (argv.empty() || pid > 0)
+		return EINVAL;
+
+	int in[2] = {-1, -1};
+	int out[2] = {-1, -1};
+	// 다른 스레드에서 동시에 실행하는 프로세스가 파이프를 상속하지 않도록 O_CLOEXEC
+	if (((pipes & PIPE_STDIN) && pipe2(in, O_CLOEXEC) != 0) ||
+		((pipes & PIPE_STDOUT) && pipe2(out, O_CLOEXEC) != 0)) {
+		int error = errno;
+		__close(in[0]), __close(in[1]);
+		__close(out[0]), __close(out[1]);
+		return error;
+	}
+
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init(&actions);
+	if (pipes & PIPE_STDIN)
+		posix_spawn_file_actions_adddup2(&actions, in[0], STDIN_FILENO);
+	else
+		posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+	if (pipes & PIPE_STDOUT)
+		posix_spawn_file_actions_adddup2(&actions, out[1], STDOUT_FILENO);
+
+	posix_spawnattr_t attr;
+	posix_spawnattr_init(&attr);
+	sigset_t mask;
+	sigemptyset(&mask);
+	posix_spawnattr_setsigmask(&attr, &mask);
+	sigset_t defaults;
+	sigemptyset(&defaults);
+	sigaddset(&defaults, SIGPIPE);
+	sigaddset(&defaults, SIGCHLD);
+	sigaddset(&defaults, SIGINT);
+	sigaddset(&defaults, SIGTERM);
+	posix_spawnattr_setsigdefault(&attr, &defaults);
+	posix_spawnattr_setpgroup(&attr, 0);
+	short flags = POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETPGROUP;
+#ifdef POSIX_SPAWN_USEVFORK
+	flags |= POSIX_SPAWN_USEVFORK;	// glibc 2.24 미만
+#endif
+	posix_spawnattr_setflags(&attr, flags);
+
+	std::vector<char *> args;
+	for (auto &&arg : argv)
+		args.push_back(const_cast<char *>(arg.c_str()));
+	args.push_back(NULL);
+
+	int rc = posix_spawnp(&pid, args[0], &actions, &attr, args.data(), environ);
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&actions);
+
+	__close(in[0]);
+	__close(out[1]);
+	if (rc != 0) {
+		pid = -1;
+		__close(in[1]);
+		__close(out[0]);
+		return rc;
+	}
+
+	stdin_fd = in[1];
+	stdout_fd = out[0];
+	status = -1;
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		종료 대기
+ * @details		제한 시간이 지나면 프로세스 그룹 전체를 SIGKILL로 종료한다.
+ * @param[in]	timeout	제한 시간 (ms, 0 이하: 제한 없음)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a ETIMEDOUT is returned.
+ */
+int Process::wait(const long timeout) {
+	if (pid <= 0)
+		return EXIT_SUCCESS;
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (int interval = 1; ; interval = std::min(interval * 2, MAX_POLL_INTERVAL)) {
+		pid_t rc = waitpid(pid, &status, WNOHANG);
+		if (rc == pid || (rc < 0 && errno != EINTR)) {
+			pid = -1;
+			return EXIT_SUCCESS;
+		}
+
+		long elapsed = __elapsed(start);
+		if (timeout > 0 && elapsed >= timeout) {
+			kill();
+			return ETIMEDOUT;
+		}
+		poll(NULL, 0, timeout > 0 ? static_cast<int>(std::min<long>(interval, timeout - elapsed)) : interval);
+	}
+}
+
+/**
+ * @brief		프로세스 그룹 강제 종료
+ */
+void Process::kill() {
+	if (pid <= 0)
+		return;
+
+	::kill(-pid, SIGKILL);
+	while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+		;
+	pid = -1;
+}
+
+void Process::closeStdin() {
+	__close(stdin_fd);
+}
+
+void Process::closeStdout() {
+	__close(stdout_fd);
+}
+
+/**
+ * @brief		종료 코드
+ * @return		정상 종료: 종료 코드, 시그널로 종료: 128 + 시그널 번호, 실행 중: -1
+ */
+int Process::getExitCode() const {
+	if (pid > 0 || status < 0)
+		return -1;
+	if (WIFEXITED(status))
+		return WEXITSTATUS(status);
+	if (WIFSIGNALED(status))
+		return 128 + WTERMSIG(status);
+	return -1;
+}
+
+/**
+ * @brief		설정 파일의 명령을 인수 벡터로 분리
+ * @details		셸을 거치지 않으므로 공백으로만 분리하며 따옴표나 리다이렉션은 해석하지 않는다.
+ */
+std::vector<std::string> itfact::common::splitCommand(const std::string &command) {
+	std::vector<std::string> argv;
+	std::string trimmed = boost::algorithm::trim_copy(command);
+	if (!trimmed.empty())
+		boost::split(argv, trimmed, boost::is_any_of(" \t"), boost::token_compress_on);
+	return argv;
+}
+
+/**
+ * @brief		로그 출력용 명령 문자열
+ */
+std::string itfact::common::toString(const std::vector<std::string> &argv) {
+	return boost::algorithm::join(argv, " ");
+}
+
+/**
+ * @brief		외부 프로그램을 실행하고 종료될 때까지 대기
+ * @details		input이 있으면 표준 입력으로 보내고 output이 있으면 표준 출력을 모두 저장한다.
+ * @date		2026. 10. 18. 23:19:52
+ * @param[in]	argv	프로그램과 인수
+ * @param[in]	timeout	제한 시간 (ms, 0 이하: 제한 없음)
+ * @param[in]	input	표준 입력 (NULL: /dev/null)
+ * @param[out]	output	표준 출력 (NULL: 현재 프로세스와 같음)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, the exit code (128 + signal) of the program or
+ 				a negative error code (-ETIMEDOUT, spawn 실패) is returned.
+ */
+int itfact::common::execute(const std::vector<std::string> &argv, const long timeout,
+							const std::string *input, std::string *output) {
+	Process process;
+	int rc = process.spawn(argv, (input ? Process::PIPE_STDIN : 0) | (output ? Process::PIPE_STDOUT : 0));
+	if (rc)
+		return -rc;
+
+	if (input) {
+		if (input->empty())
+			process.closeStdin();
+		else
+			fcntl(process.getStdin(), F_SETFL, fcntl(process.getStdin(), F_GETFL) | O_NONBLOCK);
+	}
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::size_t written = 0;
+	char buffer[64 * 1024];
+	SigpipeGuard guard;
+	while (process.getStdin() >= 0 || process.getStdout() >= 0) {
+		struct pollfd fds[2];
+		nfds_t count = 0;
+		if (process.getStdin() >= 0)
+			fds[count++] = {process.getStdin(), POLLOUT, 0};
+		if (process.getStdout() >= 0)
+			fds[count++] = {process.getStdout(), POLLIN, 0};
+
+		long remain = -1;
+		if (timeout > 0) {
+			remain = timeout - __elapsed(start);
+			if (remain <= 0)
+				break;
+		}
+		if (poll(fds, count, static_cast<int>(remain)) < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		for (nfds_t i = 0; i < count; ++i) {
+			if (!fds[i].revents)
+				continue;
+
+			if (fds[i].fd == process.getStdin()) {
+				ssize_t wsize = write(fds[i].fd, input->data() + written, input->size() - written);
+				if (wsize > 0)
+					written += static_cast<std::size_t>(wsize);
+				if ((wsize < 0 && errno != EAGAIN && errno != EINTR) || written >= input->size())
+					process.closeStdin();
+			} else {
+				ssize_t rsize = read(fds[i].fd, buffer, sizeof(buffer));
+				if (rsize > 0)
+					output->append(buffer, static_cast<std::size_t>(rsize));
+				else if (rsize == 0 || (errno != EAGAIN && errno != EINTR))
+					process.closeStdout();
+			}
+		}
+	}
+
+	process.closeStdin();
+	process.closeStdout();
+	long remain = 0;
+	if (timeout > 0 && (remain = timeout - __elapsed(start)) <= 0) {
+		process.kill();
+		return -ETIMEDOUT;
+	}
+	if (process.wait(remain) == ETIMEDOUT)
+		return -ETIMEDOUT;
+
+	return process.getExitCode();
+}
+
+/**
+ * @brief		상주 보조 프로세스 풀 생성
+ * @details		프로세스는 처음 사용할 때 실행한다.
+ * @date		2026. 10. 18. 23:52:40
+ * @param[in]	argv		프로그램과 인수
+ * @param[in]	capacity	최대 프로세스 수 (0이면 1)
+ * @param[in]	timeout		요청별 제한 시간 (ms, 0 이하: 제한 없음)
+ */
+CoProcessPool::CoProcessPool(const std::vector<std::string> &argv, const std::size_t capacity, const long timeout)
+: argv(argv), capacity(capacity ? capacity : 1), timeout(timeout) {
+}
+
+/**
+ * @brief		요청 처리
+ * @param[in]	input	요청 데이터
+ * @param[out]	output	응답 데이터
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int CoProcessPool::request(const std::string &input, std::string &output) {
+	std::unique_ptr<Process> process = acquire();
+	if (!process) {
+		release(std::move(process), false);
+		return EXIT_FAILURE;
+	}
+
+	int rc = exchange(process.get(), input, output);
+	// 응답 상태가 실패여도 프레임이 맞으면 프로세스는 재사용
+	release(std::move(process), rc != ETIMEDOUT && rc != EPROTO);
+	return rc == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+std::unique_ptr<Process> CoProcessPool::acquire() {
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		cond.wait(guard, [this]() {return !idle.empty() || running < capacity;});
+		++requests;
+		++running;
+		if (!idle.empty()) {
+			std::unique_ptr<Process> process = std::move(idle.back());
+			idle.pop_back();
+			return process;
+		}
+		++spawns;
+	}
+
+	std::unique_ptr<Process> process(new Process);
+	if (process->spawn(argv, Process::PIPE_STDIN | Process::PIPE_STDOUT))
+		process.reset();
+	else	// 제한 시간을 지키기 위해 큰 요청도 나눠서 씀
+		fcntl(process->getStdin(), F_SETFL, fcntl(process->getStdin(), F_GETFL) | O_NONBLOCK);
+	return process;
+}
+
+void CoProcessPool::release(std::unique_ptr<Process> process, const bool reuse) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		--running;
+		if (process && reuse)
+			idle.push_back(std::move(process));
+		else
+			++failures;
+	}
+	cond.notify_one();
+	// 재사용하지 않는 프로세스는 소멸자에서 종료
+}
+
+/**
+ * @brief		요청 프레임을 보내고 응답 프레임을 받음
+ * @return		응답 상태가 성공이면 EXIT_SUCCESS, 실패면 EXIT_FAILURE,
+ 				시간 초과는 ETIMEDOUT, 입출력 오류나 잘못된 응답은 EPROTO
+ */
+int CoProcessPool::exchange(Process *process, const std::string &input, std::string &output) {
+	std::string request = std::to_string(input.size());
+	request.push_back('\n');
+	request.append(input);
+
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	SigpipeGuard guard;
+	std::size_t written = 0;
+	std::string response;
+	std::size_t header = std::string::npos;		// 응답 헤더 길이
+	std::size_t length = 0;
+	int status = 0;
+	char buffer[64 * 1024];
+	for (;;) {
+		long remain = -1;
+		if (timeout > 0 && (remain = timeout - __elapsed(start)) <= 0)
+			return ETIMEDOUT;
+
+		struct pollfd fd = written < request.size() ?
+			pollfd{process->getStdin(), POLLOUT, 0} : pollfd{process->getStdout(), POLLIN, 0};
+		int rc = poll(&fd, 1, static_cast<int>(remain));
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc < 0)
+			return EPROTO;
+		if (rc == 0)
+			continue;
+
+		if (written < request.size()) {
+			ssize_t wsize = write(fd.fd, request.data() + written, request.size() - written);
+			if (wsize < 0 && errno != EINTR && errno != EAGAIN)
+				return EPROTO;
+			if (wsize > 0)
+				written += static_cast<std::size_t>(wsize);
+			continue;
+		}
+
+		ssize_t rsize = read(fd.fd, buffer, sizeof(buffer));
+		if (rsize < 0 && errno == EINTR)
+			continue;
+		if (rsize <= 0)
+			return EPROTO;
+		response.append(buffer, static_cast<std::size_t>(rsize));
+
+		if (header == std::string::npos) {
+			std::size_t eol = response.find('\n');
+			if (eol == std::string::npos)
+				continue;
+			char *end = NULL;
+			status = static_cast<int>(std::strtol(response.c_str(), &end, 10));
+			if (*end != '\t')
+				return EPROTO;
+			length = std::strtoul(end + 1, &end, 10);
+			if (*end != '\n')
+				return EPROTO;
+			header = eol + 1;
+		}
+
+		if (response.size() > header + length)
+			return EPROTO;
+		if (response.size() == header + length) {
+			output.append(response, header, length);
+			return status ? EXIT_FAILURE : EXIT_SUCCESS;
+		}
+	}
+}
+
+void CoProcessPool::stats(const std::string &prefix, std::string &result) {
+	std::lock_guard<std::mutex> guard(lock);
+	result.append(prefix).append(".processes\t").append(std::to_string(idle.size() + running)).push_back('\n');
+	result.append(prefix).append(".capacity\t").append(std::to_string(capacity)).push_back('\n');
+	result.append(prefix).append(".requests\t").append(std::to_string(requests)).push_back('\n');
+	result.append(prefix).append(".spawns\t").append(std::to_string(spawns)).push_back('\n');
+	result.append(prefix).append(".failures\t").append(std::to_string(failures)).push_back('\n');
+}
@@ -0,0 +1,63 @@
+/**
+ * @file	task_pool.cc
+ * @brief	작업 스레드 풀
+ * @details
+ * @date	2026. 10. 18. 21:44:18
+ * @see		task_pool.hpp
+ */
+#include "task_pool.hpp"
+
+using namespace itfact::common;
+
+/**
+ * @brief		스레드 생성
+ * @param[in]	count	스레드 수 (0이면 1)
+ */
+TaskPool::TaskPool(const std::size_t count) {
+	for (std::size_t i = 0; i < (count ? count : 1); ++i)
+		threads.push_back(std::thread(&TaskPool::work, this));
+}
+
+/**
+ * @brief		남은 작업을 모두 처리한 후 스레드 종료
+ */
+TaskPool::~TaskPool() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		running = false;
+	}
+	cond.notify_all();
+	for (auto &&thread : threads)
+		thread.join();
+}
+
+/**
+ * @brief		작업 추가
+ * @param[in]	fn	작업 (예외는 future로 전달됨)
+ * @return		작업 결과
+ */
+std::future<int> TaskPool::submit(const std::function<int ()> &fn) {
+	std::shared_ptr<std::packaged_task<int ()>> task = std::make_shared<std::packaged_task<int ()>>(fn);
+	std::future<int> result = task->get_future();
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		tasks.push_back([task]() {(*task)();});
+	}
+	cond.notify_one();
+	return result;
+}
+
+void TaskPool::work() {
+	for (;;) {
+		std::function<void ()> task;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			cond.wait(guard, [this]() {return !running || !tasks.empty();});
+			if (tasks.empty())
+				return;
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+		task();
+	}
+}
@@ -0,0 +1,204 @@
+/**
+ * @file	topology.cc
+ * @brief	CPU 배치 관리
+ * @details
+ * @date	2026. 10. 18. 13:24:52
+ * @see		topology.hpp
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <tuple>
+
+#include <pthread.h>
+
+#include "topology.hpp"
+
+using namespace itfact::common;
+
+/**
+ * @brief		CPU의 topology 정보 반환
+ * @param[in]	cpu		CPU 번호
+ * @param[in]	name	physical_package_id, core_id
+ * @return		값을 읽을 수 없는 경우 -1
+ */
+static int readCpuTopology(const int cpu, const char *name) {
+	char pathname[128];
+	std::snprintf(pathname, sizeof(pathname), "/sys/devices/system/cpu/cpu%d/topology/%s", cpu, name);
+
+	std::ifstream input(pathname);
+	int value = -1;
+	if (!(input >> value))
+		return -1;
+	return value;
+}
+
+/**
+ * @brief		프로세스에 허용된 CPU 목록 확인
+ * @details		sched_getaffinity()로 허용된 CPU만 사용하므로 taskset이나 cgroup 설정을 따른다.
+ 			같은 물리 코어의 CPU가 연속되도록 (패키지, 코어, CPU) 순서로 정렬한다.
+ * @date		2026. 10. 18. 13:31:07
+ */
+Topology::Topology() {
+	cpu_set_t allowed;
+	CPU_ZERO(&allowed);
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+		return;
+
+	std::vector<std::tuple<int, int, int>> order;
+	for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+		if (!CPU_ISSET(cpu, &allowed))
+			continue;
+		order.push_back(std::make_tuple(readCpuTopology(cpu, "physical_package_id"),
+										readCpuTopology(cpu, "core_id"), cpu));
+	}
+	std::sort(order.begin(), order.end());
+
+	for (auto &&item : order)
+		cpus.push_back(std::get<2>(item));
+}
+
+/**
+ * @brief		남은 CPU 중 count개를 name 집합으로 배정
+ * @details		이미 배정된 이름이면 기존 집합을 유지한다.\n
+ 			남은 CPU가 부족하면 남은 CPU만 배정하며, 남은 CPU가 없으면 배정하지 않는다.
+ * @date		2026. 10. 18. 13:38:45
+ * @param[in]	name	집합 이름
+ * @param[in]	count	CPU 개수 (0: 남은 CPU 전체)
+ * @return		배정된 CPU 개수
+ */
+std::size_t Topology::assign(const std::string &name, const std::size_t count) {
+	std::size_t assigned = getCount(name);
+	if (assigned > 0 || next >= cpus.size())
+		return assigned;
+
+	std::size_t last = (count == 0) ? cpus.size() : std::min(cpus.size(), next + count);
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (; next < last; ++next)
+		CPU_SET(cpus[next], &set);
+
+	sets.push_back(std::make_pair(name, set));
+	return static_cast<std::size_t>(CPU_COUNT(&set));
+}
+
+/**
+ * @brief		excludes 집합을 제외한 모든 CPU를 name 집합으로 배정
+ * @details		다른 집합과 겹칠 수 있으며, 이후 assign()으로 배정할 CPU에는 영향을 주지 않는다.\n
+ 			이미 배정된 이름이면 기존 집합을 유지한다.
+ * @date		2026. 10. 19. 11:24:06
+ * @param[in]	name		집합 이름
+ * @param[in]	excludes	제외할 집합 이름
+ * @return		배정된 CPU 개수
+ */
+std::size_t Topology::assignExcept(const std::string &name, const std::vector<std::string> &excludes) {
+	std::size_t assigned = getCount(name);
+	if (assigned > 0)
+		return assigned;
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (auto &&cpu : cpus) {
+		bool excluded = false;
+		for (auto &&exclude : excludes) {
+			const cpu_set_t *other = getCpuSet(exclude);
+			excluded = excluded || (other && CPU_ISSET(cpu, other));
+		}
+		if (!excluded)
+			CPU_SET(cpu, &set);
+	}
+	if (CPU_COUNT(&set) == 0)
+		return 0;
+
+	sets.push_back(std::make_pair(name, set));
+	return static_cast<std::size_t>(CPU_COUNT(&set));
+}
+
+/**
+ * @brief		name 집합 반환
+ * @return		배정되지 않은 경우 NULL
+ */
+const cpu_set_t *Topology::getCpuSet(const std::string &name) const {
+	for (auto &&item : sets) {
+		if (item.first.compare(name) == 0)
+			return &item.second;
+	}
+	return NULL;
+}
+
+std::size_t Topology::getCount(const std::string &name) const {
+	const cpu_set_t *set = getCpuSet(name);
+	return set ? static_cast<std::size_t>(CPU_COUNT(set)) : 0;
+}
+
+/**
+ * @brief		호출 스레드를 name 집합에 고정
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a error code is returned indicating what went wrong.
+ */
+int Topology::bind(const std::string &name) const {
+	const cpu_set_t *set = getCpuSet(name);
+	if (set == NULL)
+		return EXIT_SUCCESS;
+	return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), set);
+}
+
+/**
+ * @brief		배정 내역 반환
+ * @return		"gearman=0,8 engine=1-2,9-10 omp=3-7,11-15" 형식의 문자열
+ */
+std::string Topology::toString() const {
+	std::string result;
+	for (auto &&item : sets) {
+		if (!result.empty())
+			result.push_back(' ');
+		result.append(item.first).append("=").append(toString(item.second));
+	}
+	if (next < cpus.size()) {
+		cpu_set_t rest;
+		CPU_ZERO(&rest);
+		for (std::size_t i = next; i < cpus.size(); ++i)
+			CPU_SET(cpus[i], &rest);
+		if (!result.empty())
+			result.push_back(' ');
+		result.append("unassigned=").append(toString(rest));
+	}
+	return result;
+}
+
+/**
+ * @brief		CPU 집합을 "0-3,8" 형식의 문자열로 변환
+ */
+std::string Topology::toString(const cpu_set_t &set) {
+	std::string result;
+	for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+		if (!CPU_ISSET(cpu, &set))
+			continue;
+
+		int last = cpu;
+		while (last + 1 < CPU_SETSIZE && CPU_ISSET(last + 1, &set))
+			++last;
+
+		if (!result.empty())
+			result.push_back(',');
+		result.append(std::to_string(cpu));
+		if (last > cpu)
+			result.append("-").append(std::to_string(last));
+		cpu = last;
+	}
+	return result;
+}
+
+ScopedAffinity::ScopedAffinity(const cpu_set_t *set) {
+	if (set == NULL)
+		return;
+	if (pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved) != 0)
+		return;
+	changed = (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), set) == 0);
+}
+
+ScopedAffinity::~ScopedAffinity() {
+	if (changed)
+		pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file	ssp_server.cc
+ * @brief	SSP 분류기 상주 프로세스 (ssp.server)
+ * @details	CoProcessPool의 프레임 형식(요청: <길이>\n<MLF>, 응답: <상태>\t<길이>\n<CLS>)으로
+ 			표준 입출력에서 요청을 반복 처리한다.\n
+ 			분류기(MlfClassify_new.exe)는 한 번 실행에 파일 하나만 처리하므로 요청마다 MLF를 임시 파일로 저장하고
+ 			분류기를 실행한다. 상주 모드가 있는 분류기로 바꾸기 전까지 ssp.server를 사용할 수 있게 하는 참조 구현이며,
+ 			gearman 워커 대신 이 프로세스가 분류기 실행을 기다린다.\n
+ 			명령의 {mlf}, {cls}는 임시 파일 이름으로 바뀌며, {cls}가 없으면 분류기의 표준 출력을 CLS로 사용한다.
+ 			분류기의 표준 출력은 프레임과 섞이지 않도록 항상 파이프로 받는다.
+ * @date	2026. 10. 19. 11:52:08
+ * @see		process.hpp, VRServer::ssp_request()
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+
+#include "process.hpp"
+
+namespace po = boost::program_options;
+
+/**
+ * @brief		요청 프레임 읽기
+ * @param[out]	mlf		MLF 데이터
+ * @return		요청이 있으면 EXIT_SUCCESS, 입력이 끝났거나 형식이 잘못되었으면 EXIT_FAILURE
+ */
+static int readRequest(std::string &mlf) {
+	std::string header;
+	if (!std::getline(std::cin, header))
+		return EXIT_FAILURE;
+
+	char *end = NULL;
+	errno = 0;
+	const unsigned long length = std::strtoul(header.c_str(), &end, 10);
+	if (header.empty() || *end != '\0' || errno) {
+		std::cerr << "ssp_server: invalid request header: " << header << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	mlf.resize(length);
+	if (length > 0 && !std::cin.read(&mlf[0], static_cast<std::streamsize>(length))) {
+		std::cerr << "ssp_server: truncated request (" << length << " bytes)" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+static void writeResponse(const int status, const std::string &cls) {
+	std::cout << status << '\t' << cls.size() << '\n';
+	std::cout.write(cls.data(), static_cast<std::streamsize>(cls.size()));
+	std::cout.flush();
+}
+
+/**
+ * @brief		MLF 하나를 분류
+ * @param[in]	command		분류기 명령 ({mlf}, {cls} 치환 전)
+ * @param[in]	tmpdir		임시 파일 디렉토리
+ * @param[in]	timeout		분류기 제한 시간 (ms)
+ * @param[in]	mlf			MLF 데이터
+ * @param[out]	cls			CLS 데이터
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+static int classify(const std::vector<std::string> &command, const std::string &tmpdir, const long timeout,
+					const std::string &mlf, std::string &cls) {
+	std::string mlf_file(tmpdir);
+	mlf_file.append("/ssp.XXXXXX");
+	const int fd = mkstemp(&mlf_file[0]);
+	if (fd < 0) {
+		std::cerr << "ssp_server: cannot create temporary file in " << tmpdir << ": " << std::strerror(errno)
+				  << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::FILE *fp = fdopen(fd, "wb");
+	if (!fp) {
+		close(fd);
+		std::remove(mlf_file.c_str());
+		return EXIT_FAILURE;
+	}
+	bool success = std::fwrite(mlf.data(), 1, mlf.size(), fp) == mlf.size();
+	success = (std::fclose(fp) == 0) && success;
+	if (!success) {
+		std::cerr << "ssp_server: cannot write file: " << mlf_file << std::endl;
+		std::remove(mlf_file.c_str());
+		return EXIT_FAILURE;
+	}
+
+	const std::string cls_file(mlf_file + ".cls");
+	bool use_file = false;
+	std::vector<std::string> argv;
+	for (auto &&arg : command) {
+		if (arg == "{mlf}") {
+			argv.push_back(mlf_file);
+		} else if (arg == "{cls}") {
+			argv.push_back(cls_file);
+			use_file = true;
+		} else {
+			argv.push_back(arg);
+		}
+	}
+
+	std::string output;
+	int rc = itfact::common::execute(argv, timeout, NULL, &output);
+	if (rc != EXIT_SUCCESS)
+		std::cerr << "ssp_server: error(" << rc << ") occurred during execution '"
+				  << itfact::common::toString(argv) << "'" << std::endl;
+
+	if (rc == EXIT_SUCCESS && use_file) {
+		std::ifstream input(cls_file, std::ios::binary);
+		if (input.is_open()) {
+			cls.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+		} else {
+			std::cerr << "ssp_server: cannot open file: " << cls_file << std::endl;
+			rc = EXIT_FAILURE;
+		}
+	} else if (rc == EXIT_SUCCESS) {
+		cls.swap(output);
+	}
+
+	std::remove(mlf_file.c_str());
+	std::remove(cls_file.c_str());
+	return rc == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(const int argc, char const *argv[]) {
+	std::vector<std::string> command;
+	std::string tmpdir;
+	long timeout;
+
+	po::options_description desc("Usage: itf_ssp_server [options] [command ...]");
+	desc.add_options()
+		("help,h", "Show this help")
+		("tmpdir,d", po::value<std::string>(&tmpdir)->default_value("/tmp"), "Directory for MLF and CLS files")
+		("timeout,t", po::value<long>(&timeout)->default_value(60000), "Classifier timeout (ms, 0: no limit)")
+		("command", po::value<std::vector<std::string>>(&command)->multitoken(),
+		 "Classifier command; {mlf} and {cls} are replaced with file names, "
+		 "stdout is used as CLS without {cls} (default: ./bin/MlfClassify_new.exe ./out {mlf} {cls} 5 500)");
+	po::positional_options_description positional;
+	positional.add("command", -1);
+
+	try {
+		po::variables_map vm;
+		po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+		po::notify(vm);
+		if (vm.count("help")) {
+			std::cerr << desc << std::endl;
+			return EXIT_SUCCESS;
+		}
+	} catch (std::exception &e) {
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (command.empty())
+		command = {"./bin/MlfClassify_new.exe", "./out", "{mlf}", "{cls}", "5", "500"};
+	std::ios::sync_with_stdio(false);
+
+	// 입력이 끝나면(풀 종료) 정상 종료, 형식이 잘못되면 풀이 프로세스를 다시 실행하도록 종료
+	std::string mlf, cls;
+	for (;;) {
+		if (readRequest(mlf))
+			return std::cin.eof() && mlf.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+
+		cls.clear();
+		const int status = classify(command, tmpdir, timeout, mlf, cls);
+		writeResponse(status, status ? std::string() : cls);
+		mlf.clear();
+	}
+}
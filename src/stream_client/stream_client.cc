@@ -0,0 +1,329 @@
+/**
+ * @file	stream_client.cc
+ * @brief	실시간 STT 스트리밍 테스트 클라이언트
+ * @details	Gearman 없이 스트리밍 서버(stream.listen)에 연결하여 8kHz 16bit PCM 파일을 v1 또는 v2 패킷으로
+ 			나눠 보내고 응답 프레임을 출력한다.\n
+ 			송신 스레드는 응답을 기다리지 않고 프레임을 계속 보내므로(--inflight로 제한 가능) 서버의 window가 차면
+ 			TCP 흐름 제어로 송신이 멈춘다. 응답을 기다리는 최대 프레임 수와 응답 지연 시간을 함께 출력한다.\n
+ 			--calls로 여러 통화의 패킷을 한 연결에 섞어 보낼 수 있다.
+ * @date	2026. 10. 19. 11:08:42
+ * @see		stream_server.hpp, rt_packet.hpp
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <endian.h>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <boost/program_options.hpp>
+
+#include "rt_packet.hpp"
+#include "stream_server.hpp"
+
+namespace po = boost::program_options;
+using namespace itfact::vr::node;
+
+static const std::size_t WAVE_HEADER_SIZE = 44;
+static const std::size_t SAMPLE_RATE = 8000;
+static const char UNIX_PREFIX[] = "unix:";
+
+static bool __read(const int fd, void *buffer, const std::size_t size) {
+	char *data = static_cast<char *>(buffer);
+	for (std::size_t done = 0; done < size;) {
+		const ssize_t rc = ::recv(fd, data + done, size - done, 0);
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc <= 0)
+			return false;
+		done += rc;
+	}
+	return true;
+}
+
+static bool __write(const int fd, const void *buffer, const std::size_t size) {
+	const char *data = static_cast<const char *>(buffer);
+	for (std::size_t done = 0; done < size;) {
+		const ssize_t rc = ::send(fd, data + done, size - done, MSG_NOSIGNAL);
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc <= 0)
+			return false;
+		done += rc;
+	}
+	return true;
+}
+
+/**
+ * @brief		서버 연결
+ * @param[in]	address		"unix:경로" 또는 "호스트:포트"
+ * @return		소켓, 실패한 경우 -1
+ */
+static int connectServer(const std::string &address) {
+	if (address.compare(0, sizeof(UNIX_PREFIX) - 1, UNIX_PREFIX) == 0) {
+		const std::string path = address.substr(sizeof(UNIX_PREFIX) - 1);
+		struct sockaddr_un addr;
+		if (path.empty() || path.size() >= sizeof(addr.sun_path))
+			return -1;
+		std::memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+		const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (fd >= 0 && ::connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) {
+			::close(fd);
+			return -1;
+		}
+		return fd;
+	}
+
+	const std::size_t colon = address.rfind(':');
+	if (colon == std::string::npos)
+		return -1;
+	std::string host = address.substr(0, colon);
+	if (host.empty())
+		host = "localhost";
+
+	struct addrinfo hints, *addresses = NULL;
+	std::memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (::getaddrinfo(host.c_str(), address.c_str() + colon + 1, &hints, &addresses) != 0)
+		return -1;
+
+	int fd = -1;
+	for (struct addrinfo *ai = addresses; ai != NULL; ai = ai->ai_next) {
+		fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+		if (fd < 0)
+			continue;
+		if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0)
+			break;
+		::close(fd);
+		fd = -1;
+	}
+	::freeaddrinfo(addresses);
+	return fd;
+}
+
+/**
+ * @brief		요청 프레임 생성 (길이 + 패킷)
+ * @param[in]	version		패킷 형식 (1 또는 2)
+ * @param[in]	call_id		Call ID
+ * @param[in]	sequence	통화 안의 패킷 순번
+ * @param[in]	timestamp	녹음 시각 (us, 통화 시작 기준)
+ * @param[in]	state		0: FIRST, 1: 중간, 2: LAST
+ * @param[in]	pcm			음성 데이터
+ * @param[in]	size		음성 데이터 크기 (bytes)
+ * @param[out]	frame		요청 프레임
+ */
+static void buildFrame(const int version, const std::string &call_id, const uint32_t sequence,
+					   const uint64_t timestamp, const char state, const char *pcm, const std::size_t size,
+					   std::string &frame) {
+	frame.assign(sizeof(uint32_t), '\0');
+	if (version == 1) {
+		frame.append(call_id).push_back('|');
+		frame.append(state == 0 ? "FIRS" : (state == 2 ? "LAST" : "CONT")).push_back('|');
+	} else {
+		rt_packet_header_t header;
+		std::memset(&header, 0, sizeof(header));
+		header.magic[1] = 'V';
+		header.magic[2] = 'R';
+		header.version = RT_PACKET_VERSION;
+		header.header_size = htole16(static_cast<uint16_t>(sizeof(header)));
+		header.call_id_size = htole16(static_cast<uint16_t>(call_id.size()));
+		header.sequence = htole32(sequence);
+		header.timestamp = htole64(timestamp);
+		header.codec = RT_CODEC_PCM16;
+		header.flags = state == 0 ? RT_FLAG_FIRST : (state == 2 ? RT_FLAG_LAST : 0);
+		header.sample_rate = htole16(static_cast<uint16_t>(SAMPLE_RATE));
+		frame.append(reinterpret_cast<const char *>(&header), sizeof(header));
+		frame.append(call_id);
+	}
+	frame.append(pcm, size);
+
+	const uint32_t length = htole32(static_cast<uint32_t>(frame.size() - sizeof(uint32_t)));
+	std::memcpy(&frame[0], &length, sizeof(length));
+}
+
+static double percentile(std::vector<double> &values, const double ratio) {
+	if (values.empty())
+		return 0;
+	const std::size_t idx = std::min(values.size() - 1, static_cast<std::size_t>(ratio * values.size()));
+	std::nth_element(values.begin(), values.begin() + idx, values.end());
+	return values[idx];
+}
+
+int main(const int argc, char const *argv[]) {
+	std::string address, input, call_id;
+	int version;
+	std::size_t calls, packet_ms, inflight;
+	bool realtime = false, quiet = false;
+
+	po::options_description desc("Usage");
+	desc.add_options()
+		("help,h", "Show this help")
+		("address,a", po::value<std::string>(&address)->required(), "Stream server, \"host:port\" or \"unix:/path\"")
+		("input,i", po::value<std::string>(&input)->required(), "8kHz 16bit mono PCM or WAVE file")
+		("call-id", po::value<std::string>(&call_id)->default_value("stream"), "Call ID (\"<id>_<n>\" with --calls)")
+		("calls,c", po::value<std::size_t>(&calls)->default_value(1), "Calls interleaved on the connection")
+		("version,v", po::value<int>(&version)->default_value(2), "Packet format (1 or 2)")
+		("packet-ms", po::value<std::size_t>(&packet_ms)->default_value(100), "Audio per packet (ms)")
+		("inflight", po::value<std::size_t>(&inflight)->default_value(0),
+		 "Frames sent ahead of replies (0: unlimited, paced by the server window)")
+		("realtime", po::bool_switch(&realtime), "Send one packet per call every packet-ms")
+		("quiet,q", po::bool_switch(&quiet), "Print the summary only");
+
+	try {
+		po::variables_map vm;
+		po::store(po::parse_command_line(argc, argv, desc), vm);
+		if (vm.count("help")) {
+			std::cout << desc << std::endl;
+			return EXIT_SUCCESS;
+		}
+		po::notify(vm);
+	} catch (std::exception &e) {
+		std::fprintf(stderr, "%s\n%s", e.what(), "Try --help\n");
+		return EXIT_FAILURE;
+	}
+	if ((version != 1 && version != 2) || calls == 0 || packet_ms == 0) {
+		std::fprintf(stderr, "Invalid argument\n");
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream file(input, std::ifstream::binary);
+	if (!file.is_open()) {
+		std::fprintf(stderr, "Cannot open %s: %s\n", input.c_str(), std::strerror(errno));
+		return EXIT_FAILURE;
+	}
+	if (input.size() > 4 && input.compare(input.size() - 4, 4, ".wav") == 0)
+		file.seekg(WAVE_HEADER_SIZE);
+	std::vector<char> pcm((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	pcm.resize(pcm.size() & ~static_cast<std::size_t>(1));
+	if (pcm.empty()) {
+		std::fprintf(stderr, "No audio: %s\n", input.c_str());
+		return EXIT_FAILURE;
+	}
+
+	const int fd = connectServer(address);
+	if (fd < 0) {
+		std::fprintf(stderr, "Cannot connect to %s: %s\n", address.c_str(), std::strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	const std::size_t packet_bytes = SAMPLE_RATE * packet_ms / 1000 * sizeof(short);
+	const std::size_t packets = (pcm.size() + packet_bytes - 1) / packet_bytes;
+	const std::size_t total = packets * calls;
+
+	// 응답은 요청 순서대로 오므로 보낸 시각을 순서대로 보관
+	std::mutex lock;
+	std::condition_variable cond;
+	std::deque<std::chrono::steady_clock::time_point> pending;
+	std::size_t max_pending = 0;
+	bool closed = false;
+
+	const auto start = std::chrono::steady_clock::now();
+	std::thread sender([&] {
+		std::string frame;
+		auto due = std::chrono::steady_clock::now();
+		for (std::size_t p = 0; p < packets; ++p) {
+			const std::size_t offset = p * packet_bytes;
+			const std::size_t size = std::min(packet_bytes, pcm.size() - offset);
+			const char state = p == 0 ? 0 : (p + 1 == packets ? 2 : 1);
+			for (std::size_t c = 0; c < calls; ++c) {
+				const std::string id = calls > 1 ? call_id + "_" + std::to_string(c) : call_id;
+				buildFrame(version, id, static_cast<uint32_t>(p), p * packet_ms * 1000, state, pcm.data() + offset,
+						   size, frame);
+
+				{
+					std::unique_lock<std::mutex> guard(lock);
+					cond.wait(guard, [&] {return closed || !inflight || pending.size() < inflight;});
+					if (closed)
+						return;
+					pending.push_back(std::chrono::steady_clock::now());
+					max_pending = std::max(max_pending, pending.size());
+				}
+				if (!__write(fd, frame.data(), frame.size())) {
+					std::fprintf(stderr, "Cannot send: %s\n", std::strerror(errno));
+					::shutdown(fd, SHUT_RDWR);
+					return;
+				}
+			}
+
+			if (realtime) {
+				due += std::chrono::milliseconds(packet_ms);
+				std::this_thread::sleep_until(due);
+			}
+		}
+	});
+
+	std::size_t replies = 0, errors = 0;
+	std::vector<double> latency;
+	std::vector<char> body;
+	while (replies < total) {
+		uint32_t length;
+		if (!__read(fd, &length, sizeof(length)))
+			break;
+		length = le32toh(length);
+		stream_reply_header_t header;
+		if (length < sizeof(header))
+			break;
+		body.resize(length);
+		if (!__read(fd, body.data(), length))
+			break;
+		std::memcpy(&header, body.data(), sizeof(header));
+		const std::size_t id_size = std::min<std::size_t>(le16toh(header.call_id_size), length - sizeof(header));
+
+		const auto now = std::chrono::steady_clock::now();
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (!pending.empty()) {
+				latency.push_back(std::chrono::duration<double, std::milli>(now - pending.front()).count());
+				pending.pop_front();
+			}
+		}
+		cond.notify_all();
+
+		++replies;
+		if (header.status != STREAM_OK)
+			++errors;
+		if (!quiet || header.status != STREAM_OK) {
+			const char *text = body.data() + sizeof(header) + id_size;
+			std::printf("%.*s\tseq=%u\tstate=%u\t%s\t%.*s\n", static_cast<int>(id_size), body.data() + sizeof(header),
+						le32toh(header.sequence), header.state, header.status == STREAM_OK ? "OK" : "ERROR",
+						static_cast<int>(body.data() + length - text), text);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		closed = true;
+	}
+	cond.notify_all();
+	::shutdown(fd, SHUT_RDWR);
+	sender.join();
+	::close(fd);
+
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::printf("frames: %lu, replies: %lu, errors: %lu, max in flight: %lu, elapsed: %.3f s, "
+				"latency p50: %.1f ms, p99: %.1f ms\n", total, replies, errors, max_pending, elapsed,
+				percentile(latency, 0.5), percentile(latency, 0.99));
+
+	return replies == total && errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,838 @@
+/**
+ * @file	tuner.cc
+ * @brief	처리량 자동 튜너
+ * @details	후보 설정마다 VR 서버를 별도 프로세스로 실행한 후 샘플 녹취를 Gearman으로 요청하여
+ 			RTF, 처리량, 지연 시간을 측정하고 권장 env.conf 섹션을 생성한다.\n
+ 			측정 요청이 운영 중인 워커로 전달되지 않도록 tuner.gearmand 옵션으로 전용 Job 서버를
+ 			실행하거나 격리된 Job 서버를 지정해야 한다.
+ * @date	2026. 10. 18. 10:05:12
+ * @see		vr_server.cc
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem.hpp>
+#include <libgearman/gearman.h>
+
+#include "tuner.hpp"
+
+#define THREAD_ID	std::this_thread::get_id()
+#define LOG_INFO	__FILE__, __FUNCTION__, __LINE__
+#define LOG_FMT		" [at %s (%s:%d)]"
+
+extern char **environ;
+
+using namespace itfact::vr::node;
+
+static const std::size_t WAVE_HEADER_SIZE = 44;
+static const std::size_t SAMPLE_RATE = 8000;
+
+static struct {
+	std::string server;
+	std::string base_config;
+	std::string work_path;
+	std::string output;
+	std::string engine_core;
+	std::string mini_batch;
+	std::string stt_worker;
+	std::string realtime_worker;
+	unsigned long port;
+	unsigned long packet_ms;
+	unsigned long realtime_seconds;
+	unsigned long startup_timeout;
+} default_config = {
+	.server = "./bin/Release/Linux_x86_64/itf_vr",
+	.base_config = "config/env.conf",
+	.work_path = "/tmp/smart-vr-tuner",
+	.output = "config/env_tuned.conf",
+	.engine_core = "1,2,4",
+	.mini_batch = "128",
+	.stt_worker = "1,2,4,8",
+	.realtime_worker = "",
+	.port = 4731,
+	.packet_ms = 200,
+	.realtime_seconds = 30,
+	.startup_timeout = 10 * 60 * 1000,
+};
+
+/**
+ */
+int main(const int argc, char const *argv[]) {
+	try {
+		VRTuner tuner(argc, argv);
+		return tuner.run();
+	} catch (std::exception &e) {
+		perror(e.what());
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		콤마로 구분된 숫자 목록 파싱
+ * @date		2026. 10. 18. 10:11:40
+ * @param[in]	value	"1,2,4" 형식의 문자열
+ * @return		파싱된 숫자 목록
+ */
+static std::vector<unsigned long> parseList(const std::string &value) {
+	std::vector<std::string> items;
+	std::vector<unsigned long> list;
+	boost::split(items, value, boost::is_any_of(", "), boost::token_compress_on);
+	for (auto &&item : items) {
+		if (item.empty())
+			continue;
+		list.push_back(std::stoul(item));
+	}
+	return list;
+}
+
+/**
+ * @brief		명령어 실행 (posix_spawn)
+ * @date		2026. 10. 18. 10:15:02
+ * @param[in]	args	실행할 명령어 및 인수
+ * @param[in]	envs	추가할 환경 변수 ("KEY=VALUE")
+ * @return		실행된 프로세스의 PID, 실패한 경우 -1
+ */
+static pid_t spawn(const std::vector<std::string> &args, const std::vector<std::string> &envs) {
+	std::vector<char *> argv;
+	for (auto &&arg : args)
+		argv.push_back(const_cast<char *>(arg.c_str()));
+	argv.push_back(NULL);
+
+	std::vector<std::string> env_list(envs);
+	for (char **env = environ; env && *env; ++env) {
+		std::string item(*env);
+		std::string key = item.substr(0, item.find('=') + 1);
+		bool overridden = false;
+		for (auto &&e : envs) {
+			if (e.compare(0, key.size(), key) == 0) {
+				overridden = true;
+				break;
+			}
+		}
+		if (!overridden)
+			env_list.push_back(item);
+	}
+	std::vector<char *> envp;
+	for (auto &&env : env_list)
+		envp.push_back(const_cast<char *>(env.c_str()));
+	envp.push_back(NULL);
+
+	pid_t pid;
+	if (posix_spawnp(&pid, argv[0], NULL, NULL, argv.data(), envp.data()) != 0)
+		return -1;
+	return pid;
+}
+
+static std::vector<std::string> splitCommand(const std::string &command) {
+	std::vector<std::string> args;
+	boost::split(args, command, boost::is_any_of(" \t"), boost::token_compress_on);
+	args.erase(std::remove(args.begin(), args.end(), std::string("")), args.end());
+	return args;
+}
+
+/**
+ * @brief		정렬된 값에서 백분위 값을 구함
+ */
+static double percentile(std::vector<double> values, const double ratio) {
+	if (values.empty())
+		return 0;
+	std::sort(values.begin(), values.end());
+	std::size_t idx = static_cast<std::size_t>(ratio * (values.size() - 1) + 0.5);
+	return values[std::min(idx, values.size() - 1)];
+}
+
+/**
+ * @brief		기존 값 대비 변화율 (%)
+ * @return		기존 값이 0이면 0
+ */
+static double change(const double before, const double after) {
+	return before > 0 ? (after - before) * 100 / before : 0;
+}
+
+/**
+ * @brief		프로세스의 CPU 사용 시간 (user + system, 초)
+ * @date		2026. 10. 19. 04:06:52
+ * @return		/proc/<pid>/stat을 읽을 수 없으면 0
+ */
+static double cpuSeconds(const pid_t pid) {
+	std::ifstream input(std::string("/proc/") + std::to_string(pid) + "/stat");
+	std::string stat((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	// 프로세스 이름에 공백이 있을 수 있으므로 ')' 다음부터 읽음 (state, ..., utime(14), stime(15))
+	std::string::size_type idx = stat.rfind(')');
+	if (idx == std::string::npos)
+		return 0;
+	std::vector<std::string> fields;
+	std::string rest = stat.substr(idx + 2);
+	boost::split(fields, rest, boost::is_any_of(" "), boost::token_compress_on);
+	if (fields.size() < 13)
+		return 0;
+	return static_cast<double>(std::stoull(fields[11]) + std::stoull(fields[12])) / sysconf(_SC_CLK_TCK);
+}
+
+/**
+ * @brief		Gearman 요청 (동기)
+ * @date		2026. 10. 18. 10:22:31
+ * @param[in]	client		Gearman client
+ * @param[in]	function	함수명
+ * @param[in]	workload	요청 데이터
+ * @param[out]	response	응답 데이터
+ * @retval		true	Success
+ * @retval		false	Failure
+ */
+static bool submit(gearman_client_st *client, const std::string &function,
+				   const std::string &workload, std::string &response) {
+	size_t result_size = 0;
+	gearman_return_t rc;
+	void *result = gearman_client_do(client, function.c_str(), NULL,
+									 workload.c_str(), workload.size(), &result_size, &rc);
+	if (result) {
+		response.assign(static_cast<char *>(result), result_size);
+		free(result);
+	}
+	return !gearman_failed(rc);
+}
+
+VRTuner::VRTuner(const int argc, const char *argv[]) : config(argc, argv) {
+	logger = config.getLogger();
+	gearman_host = config.getHost();
+	gearman_port = config.getPort();
+}
+
+VRTuner::~VRTuner() {
+	if (gearmand > 0)
+		stopServer(gearmand);
+}
+
+/**
+ * @brief		샘플 녹취 목록 로드
+ * @details		8kHz, 16bit, mono 형식의 WAVE(.wav) 또는 RAW PCM(.pcm) 파일만 사용한다.
+ * @date		2026. 10. 18. 10:31:05
+ * @param[in]	path	샘플 녹취 디렉터리
+ * @retval		true	Success
+ * @retval		false	Failure
+ */
+bool VRTuner::loadCorpus(const std::string &path) {
+	namespace fs = boost::filesystem;
+	try {
+		for (fs::directory_iterator iter(path); iter != fs::directory_iterator(); ++iter) {
+			if (!fs::is_regular_file(iter->status()))
+				continue;
+
+			std::string ext = iter->path().extension().string();
+			boost::algorithm::to_lower(ext);
+			if (ext.compare(".wav") != 0 && ext.compare(".pcm") != 0)
+				continue;
+
+			tune_sample_t sample;
+			sample.pathname = fs::absolute(iter->path()).string();
+			sample.is_wave = (ext.compare(".wav") == 0);
+			std::size_t size = fs::file_size(iter->path());
+			if (sample.is_wave)
+				size = size > WAVE_HEADER_SIZE ? size - WAVE_HEADER_SIZE : 0;
+			sample.seconds = static_cast<double>(size / sizeof(short)) / SAMPLE_RATE;
+			if (sample.seconds <= 0)
+				continue;
+			corpus.push_back(sample);
+		}
+	} catch (std::exception &e) {
+		logger->error("Cannot read corpus: %s, %s", path.c_str(), e.what());
+		return false;
+	}
+
+	std::sort(corpus.begin(), corpus.end(), [](const tune_sample_t &a, const tune_sample_t &b) {
+		return a.pathname < b.pathname;
+	});
+	return !corpus.empty();
+}
+
+/**
+ * @brief		후보 조합에 해당하는 서버 설정 파일 생성
+ * @details		tuner.base_config를 복사하며 측정에 필요한 항목만 변경한다.
+ * @date		2026. 10. 18. 10:40:27
+ * @param[in]	candidate	측정 대상 조합
+ * @param[in]	pathname	생성할 설정 파일
+ * @retval		true	Success
+ * @retval		false	Failure
+ */
+bool VRTuner::writeConfig(const tune_candidate_t &candidate, const std::string &pathname) {
+	std::map<std::string, std::map<std::string, std::string>> overrides;
+	overrides["master"]["host"] = gearman_host;
+	overrides["master"]["port"] = std::to_string(gearman_port);
+	overrides["log"]["logfile"] = pathname + ".log";
+	overrides["stt"]["engine_core"] = std::to_string(candidate.engine_core);
+	overrides["stt"]["mini_batch"] = std::to_string(candidate.mini_batch);
+	overrides["stt"]["worker"] = std::to_string(candidate.stt_worker);
+	overrides["realtime"]["worker"] = std::to_string(candidate.realtime_worker);
+	overrides["realtime"]["startnum"] = "0";
+	overrides["realtime"]["incremental"] = candidate.incremental ? "true" : "false";
+	overrides["unsegment"]["worker"] = "0";
+	overrides["ssp"]["worker"] = "0";
+	overrides["protocol"]["use"] = "false";
+	overrides["spk"]["enable"] = "false";
+
+	std::string base_config = config.getConfig("tuner.base_config", default_config.base_config.c_str());
+	std::ifstream input(base_config);
+	if (!input.is_open()) {
+		logger->error("Cannot open %s", base_config.c_str());
+		return false;
+	}
+
+	std::vector<std::string> lines;
+	std::string section;
+	auto flush_section = [&]() {
+		auto search = overrides.find(section);
+		if (search == overrides.end())
+			return;
+		for (auto &&item : search->second)
+			lines.push_back(item.first + " = " + item.second);
+		overrides.erase(search);
+	};
+
+	for (std::string line; std::getline(input, line); ) {
+		std::string trimmed = boost::algorithm::trim_copy(line);
+		if (!trimmed.empty() && trimmed[0] == '[') {
+			flush_section();
+			section = trimmed.substr(1, trimmed.find(']') - 1);
+			lines.push_back(line);
+			continue;
+		}
+
+		std::string::size_type idx = trimmed.find('=');
+		if (!trimmed.empty() && trimmed[0] != '#' && idx != std::string::npos) {
+			std::string key = boost::algorithm::trim_copy(trimmed.substr(0, idx));
+			auto search = overrides.find(section);
+			if (search != overrides.end() && search->second.count(key)) {
+				lines.push_back(key + " = " + search->second[key]);
+				search->second.erase(key);
+				continue;
+			}
+		}
+		lines.push_back(line);
+	}
+	flush_section();
+
+	for (auto &&rest : overrides) {
+		lines.push_back(std::string("[") + rest.first + "]");
+		for (auto &&item : rest.second)
+			lines.push_back(item.first + " = " + item.second);
+	}
+
+	std::ofstream output(pathname);
+	if (!output.is_open()) {
+		logger->error("Cannot write %s", pathname.c_str());
+		return false;
+	}
+	for (auto &&line : lines)
+		output << line << '\n';
+	return true;
+}
+
+/**
+ * @brief		VR 서버 실행
+ * @details		OpenMP 스레드 수는 엔진 코어를 제외한 코어를 STT 워커 수로 나눈 값으로 제한한다.
+ * @date		2026. 10. 18. 10:52:44
+ * @return		실행된 서버의 PID, 실패한 경우 -1
+ */
+pid_t VRTuner::startServer(const tune_candidate_t &candidate, const std::string &config_file) {
+	unsigned long cores = std::max(1u, std::thread::hardware_concurrency());
+	unsigned long workers = std::max(1UL, candidate.stt_worker + candidate.realtime_worker);
+	unsigned long omp_threads = cores > candidate.engine_core ? (cores - candidate.engine_core) / workers : 1;
+	if (omp_threads == 0)
+		omp_threads = 1;
+
+	std::vector<std::string> args;
+	args.push_back(config.getConfig("tuner.server", default_config.server.c_str()));
+	args.push_back("-i");
+	args.push_back(config_file);
+	args.push_back("--verbose");
+	args.push_back("INFO");
+
+	std::vector<std::string> envs;
+	envs.push_back(std::string("OMP_NUM_THREADS=") + std::to_string(omp_threads));
+
+	pid_t pid = spawn(args, envs);
+	if (pid < 0)
+		logger->error("Cannot execute %s: %s", args[0].c_str(), std::strerror(errno));
+	else
+		logger->info("Start server(%d) with %s (OMP_NUM_THREADS=%lu)", pid, config_file.c_str(), omp_threads);
+	return pid;
+}
+
+/**
+ * @brief		서버 종료
+ * @date		2026. 10. 18. 10:55:10
+ */
+void VRTuner::stopServer(pid_t pid) {
+	if (pid <= 0)
+		return;
+
+	kill(pid, SIGTERM);
+	for (int i = 0; i < 50; ++i) {
+		if (waitpid(pid, NULL, WNOHANG) == pid)
+			return;
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	kill(pid, SIGKILL);
+	waitpid(pid, NULL, 0);
+}
+
+/**
+ * @brief		파일 단위 STT(vr_stt) 처리량 측정
+ * @details		stt.worker 수 만큼 동시에 요청하여 전체 샘플을 처리한다.
+ 			모델 로딩 시간이 측정에 포함되지 않도록 첫 번째 샘플로 예열한 후 측정한다.
+ * @date		2026. 10. 18. 11:03:58
+ * @param[in]	candidate	측정 대상 조합
+ * @param[out]	result		측정 결과
+ * @retval		true	Success
+ * @retval		false	Failure
+ */
+bool VRTuner::measureBatch(const tune_candidate_t &candidate, tune_result_t &result) {
+	unsigned long startup_timeout = config.getConfig("tuner.startup_timeout", default_config.startup_timeout);
+	std::string function("vr_stt");
+
+	gearman_client_st warmup;
+	if (gearman_client_create(&warmup) == NULL)
+		return false;
+	std::shared_ptr<gearman_client_st> warmup_client(&warmup, gearman_client_free);
+	gearman_client_add_server(warmup_client.get(), gearman_host.c_str(), static_cast<in_port_t>(gearman_port));
+	gearman_client_set_timeout(warmup_client.get(), static_cast<int>(startup_timeout));
+
+	std::string response;
+	if (!submit(warmup_client.get(), function, std::string("file://") + corpus[0].pathname, response) ||
+		response.compare(0, 7, "SUCCESS") != 0) {
+		logger->error("Warm-up failed (engine_core=%lu, mini_batch=%lu, stt.worker=%lu)",
+					  candidate.engine_core, candidate.mini_batch, candidate.stt_worker);
+		return false;
+	}
+
+	std::atomic<std::size_t> next(0);
+	std::atomic<std::size_t> failed(0);
+	std::mutex lock;
+	std::vector<double> latency;
+	double processing = 0;
+
+	auto client_thread = [&]() {
+		gearman_client_st _client;
+		if (gearman_client_create(&_client) == NULL) {
+			failed.fetch_add(1);
+			return;
+		}
+		std::shared_ptr<gearman_client_st> client(&_client, gearman_client_free);
+		gearman_client_add_server(client.get(), gearman_host.c_str(), static_cast<in_port_t>(gearman_port));
+
+		for (std::size_t idx = next.fetch_add(1); idx < corpus.size(); idx = next.fetch_add(1)) {
+			std::string response;
+			auto start = std::chrono::steady_clock::now();
+			bool success = submit(client.get(), function, std::string("file://") + corpus[idx].pathname, response);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			if (!success || response.compare(0, 7, "SUCCESS") != 0) {
+				failed.fetch_add(1);
+				continue;
+			}
+
+			std::lock_guard<std::mutex> guard(lock);
+			latency.push_back(elapsed.count());
+			processing += elapsed.count() / corpus[idx].seconds;
+		}
+	};
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> clients;
+	for (unsigned long i = 0; i < std::max(1UL, candidate.stt_worker); ++i)
+		clients.push_back(std::thread(client_thread));
+	for (auto &&client : clients)
+		client.join();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	result.candidate = candidate;
+	result.jobs = latency.size();
+	result.failed = failed.load();
+	result.audio_seconds = 0;
+	for (auto &&sample : corpus)
+		result.audio_seconds += sample.seconds;
+	result.elapsed = elapsed.count();
+	result.rtf = latency.empty() ? 0 : processing / latency.size();
+	result.throughput = result.elapsed > 0 ? result.audio_seconds / result.elapsed : 0;
+	result.latency_p50 = percentile(latency, 0.50);
+	result.latency_p95 = percentile(latency, 0.95);
+	result.valid = (result.failed == 0);
+
+	return result.valid;
+}
+
+/**
+ * @brief		실시간 STT(vr_realtime_N) 지연 시간 측정
+ * @details		realtime.worker 수 만큼의 통화를 동시에 실시간 속도로 전송하며
+ 			패킷별 응답 지연을 측정한다. p95 지연이 패킷 길이 이내인 경우 실시간 처리가 가능한 것으로 판단한다.\n
+ 			모델 로딩이 포함되지 않도록 짧은 통화로 예열한 후 서버의 CPU 사용 시간을 함께 측정한다.
+ * @date		2026. 10. 18. 11:26:13
+ * @param[in]	candidate	측정 대상 조합
+ * @param[in]	pid			서버 PID
+ * @param[out]	result		측정 결과
+ * @retval		true	실시간 처리 가능
+ * @retval		false	실시간 처리 불가 또는 실패
+ */
+bool VRTuner::measureRealtime(const tune_candidate_t &candidate, const pid_t pid, tune_result_t &result) {
+	unsigned long packet_ms = config.getConfig("tuner.packet_ms", default_config.packet_ms);
+	unsigned long call_seconds = config.getConfig("tuner.realtime_seconds", default_config.realtime_seconds);
+	unsigned long startup_timeout = config.getConfig("tuner.startup_timeout", default_config.startup_timeout);
+	const std::size_t packet_samples = SAMPLE_RATE * packet_ms / 1000;
+
+	std::atomic<std::size_t> failed(0);
+	std::mutex lock;
+	std::vector<double> latency;
+	std::size_t packets = 0;
+
+	gearman_client_st warmup;
+	if (gearman_client_create(&warmup) == NULL)
+		return false;
+	std::shared_ptr<gearman_client_st> warmup_client(&warmup, gearman_client_free);
+	gearman_client_add_server(warmup_client.get(), gearman_host.c_str(), static_cast<in_port_t>(gearman_port));
+	gearman_client_set_timeout(warmup_client.get(), static_cast<int>(startup_timeout));
+
+	std::string silence(packet_samples * sizeof(short), '\0');
+	std::string response;
+	if (!submit(warmup_client.get(), "vr_realtime_0", std::string("tuner_warmup|FIRS|") + silence, response) ||
+		!submit(warmup_client.get(), "vr_realtime_0", std::string("tuner_warmup|LAST|") + silence, response)) {
+		logger->error("Warm-up failed (realtime.worker=%lu)", candidate.realtime_worker);
+		return false;
+	}
+	const double cpu_start = cpuSeconds(pid);
+
+	auto call_thread = [&](const unsigned long channel) {
+		const tune_sample_t &sample = corpus[channel % corpus.size()];
+		std::ifstream input(sample.pathname, std::ifstream::binary);
+		if (!input.is_open()) {
+			failed.fetch_add(1);
+			return;
+		}
+		if (sample.is_wave)
+			input.seekg(WAVE_HEADER_SIZE);
+		std::vector<char> pcm((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+		pcm.resize(std::min(pcm.size(), call_seconds * SAMPLE_RATE * sizeof(short)));
+
+		gearman_client_st _client;
+		if (gearman_client_create(&_client) == NULL) {
+			failed.fetch_add(1);
+			return;
+		}
+		std::shared_ptr<gearman_client_st> client(&_client, gearman_client_free);
+		gearman_client_add_server(client.get(), gearman_host.c_str(), static_cast<in_port_t>(gearman_port));
+		gearman_client_set_timeout(client.get(), static_cast<int>(startup_timeout));
+
+		std::string function = std::string("vr_realtime_") + std::to_string(channel);
+		std::string call_id = std::string("tuner") + std::to_string(channel);
+		const std::size_t packet_bytes = packet_samples * sizeof(short);
+		auto due = std::chrono::steady_clock::now();
+		for (std::size_t offset = 0; offset < pcm.size(); offset += packet_bytes) {
+			std::size_t size = std::min(packet_bytes, pcm.size() - offset);
+			const char *cmd = offset == 0 ? "FIRS" : (offset + size >= pcm.size() ? "LAST" : "CONT");
+			std::string workload = call_id + "|" + cmd + "|";
+			workload.append(pcm.data() + offset, size);
+
+			std::string response;
+			auto start = std::chrono::steady_clock::now();
+			bool success = submit(client.get(), function, workload, response);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			if (!success) {
+				failed.fetch_add(1);
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				// 첫 패킷은 예열 구간이므로 제외
+				if (offset > 0)
+					latency.push_back(elapsed.count());
+				++packets;
+			}
+
+			due += std::chrono::milliseconds(packet_ms);
+			std::this_thread::sleep_until(due);
+		}
+	};
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> calls;
+	for (unsigned long i = 0; i < candidate.realtime_worker; ++i)
+		calls.push_back(std::thread(call_thread, i));
+	for (auto &&call : calls)
+		call.join();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	result.candidate = candidate;
+	result.jobs = packets;
+	result.failed = failed.load();
+	result.audio_seconds = static_cast<double>(packets * packet_ms) / 1000;
+	result.elapsed = elapsed.count();
+	result.latency_p50 = percentile(latency, 0.50);
+	result.latency_p95 = percentile(latency, 0.95);
+	result.rtf = result.latency_p50 * 1000 / packet_ms;
+	result.throughput = result.elapsed > 0 ? result.audio_seconds / result.elapsed : 0;
+	result.cpu = result.audio_seconds > 0 ? (cpuSeconds(pid) - cpu_start) / result.audio_seconds : 0;
+	result.valid = (result.failed == 0) && (result.latency_p95 * 1000 <= packet_ms);
+
+	return result.valid;
+}
+
+/**
+ * @brief		측정 결과 및 권장 설정 저장
+ * @date		2026. 10. 18. 11:48:20
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int VRTuner::writeRecommendation(
+	const std::vector<tune_result_t> &batch,
+	const std::vector<tune_result_t> &realtime,
+	const tune_result_t *best_batch,
+	const tune_result_t *best_realtime
+) {
+	std::string output = config.getConfig("tuner.output", default_config.output.c_str());
+	std::FILE *fp = std::fopen(output.c_str(), "w");
+	if (!fp) {
+		logger->error("Cannot write %s: %s", output.c_str(), std::strerror(errno));
+		return EXIT_FAILURE;
+	}
+	std::shared_ptr<std::FILE> fd(fp, std::fclose);
+
+	char date[32];
+	std::time_t now = std::time(NULL);
+	std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+	double corpus_seconds = 0;
+	for (auto &&sample : corpus)
+		corpus_seconds += sample.seconds;
+
+	std::fprintf(fd.get(), "###############################################################################\n");
+	std::fprintf(fd.get(), "# Generated by itf_tuner at %s\n", date);
+	std::fprintf(fd.get(), "# Corpus: %lu files, %.1f seconds, %u cores\n",
+				 corpus.size(), corpus_seconds, std::thread::hardware_concurrency());
+	std::fprintf(fd.get(), "#\n# engine_core mini_batch stt.worker     RTF  throughput  p50(s)  p95(s) failed\n");
+	for (auto &&r : batch) {
+		std::fprintf(fd.get(), "# %11lu %10lu %10lu %7.3f %10.2fx %7.2f %7.2f %6lu%s\n",
+					 r.candidate.engine_core, r.candidate.mini_batch, r.candidate.stt_worker,
+					 r.rtf, r.throughput, r.latency_p50, r.latency_p95, r.failed,
+					 r.valid ? "" : " (invalid)");
+	}
+	if (!realtime.empty()) {
+		std::fprintf(fd.get(), "#\n# realtime.worker        mode  p50(ms)  p95(ms)  cpu/s packets failed\n");
+		for (auto &&r : realtime) {
+			std::fprintf(fd.get(), "# %15lu %11s %8.1f %8.1f %6.3f %7lu %6lu%s\n",
+						 r.candidate.realtime_worker, r.candidate.incremental ? "incremental" : "packet",
+						 r.latency_p50 * 1000, r.latency_p95 * 1000, r.cpu,
+						 r.jobs, r.failed, r.valid ? "" : " (not realtime)");
+		}
+
+		// tuner.realtime_compare: 같은 realtime.worker의 패킷 단위 디코딩 대비 변화율
+		bool header = false;
+		for (auto &&r : realtime) {
+			if (!r.candidate.incremental)
+				continue;
+			for (auto &&p : realtime) {
+				if (p.candidate.incremental || p.candidate.realtime_worker != r.candidate.realtime_worker)
+					continue;
+				if (!header) {
+					std::fprintf(fd.get(), "#\n# incremental vs packet\n");
+					std::fprintf(fd.get(), "# realtime.worker   p50(%%)   p95(%%)  cpu/s(%%)\n");
+					header = true;
+				}
+				std::fprintf(fd.get(), "# %15lu %+8.1f %+8.1f %+9.1f%s\n", r.candidate.realtime_worker,
+							 change(p.latency_p50, r.latency_p50), change(p.latency_p95, r.latency_p95),
+							 change(p.cpu, r.cpu), (r.failed || p.failed) ? " (failed packets)" : "");
+			}
+		}
+	}
+	std::fprintf(fd.get(), "###############################################################################\n");
+
+	if (best_batch) {
+		std::fprintf(fd.get(), "[stt]\n");
+		std::fprintf(fd.get(), "engine_core = %lu\n", best_batch->candidate.engine_core);
+		std::fprintf(fd.get(), "mini_batch = %lu\n", best_batch->candidate.mini_batch);
+		std::fprintf(fd.get(), "worker = %lu\n\n", best_batch->candidate.stt_worker);
+	}
+	if (best_realtime) {
+		std::fprintf(fd.get(), "[realtime]\n");
+		std::fprintf(fd.get(), "worker = %lu\n", best_realtime->candidate.realtime_worker);
+	}
+
+	logger->info("Recommendation written to %s", output.c_str());
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		튜닝 실행
+ * @details		1단계로 engine_core, mini_batch, stt.worker 조합별 파일 단위 처리량을 측정하여
+ 			처리 배속이 가장 높은 조합을 선택하고, 2단계로 선택된 engine_core, mini_batch에서
+ 			실시간 처리가 가능한 최대 realtime.worker를 찾는다.\n
+ 			tuner.realtime_compare가 true이면 realtime.worker마다 패킷 단위 디코딩(realtime.incremental = false)도
+ 			측정하여 p50/p95 지연과 오디오 1초당 CPU 사용 시간의 변화율을 로그와 tuner.output에 기록하며,
+ 			권장 설정은 패킷 사이에 상태를 유지하는 방식으로만 선택한다.
+ * @date		2026. 10. 18. 12:02:37
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int VRTuner::run() {
+	std::string corpus_path = config.getConfig("tuner.corpus", "");
+	if (!loadCorpus(corpus_path)) {
+		logger->error("Cannot find sample files(*.wav, *.pcm) in tuner.corpus: %s", corpus_path.c_str());
+		return EXIT_FAILURE;
+	}
+
+	work_path = config.getConfig("tuner.work_path", default_config.work_path.c_str());
+	if (work_path.at(work_path.size() - 1) != '/')
+		work_path.push_back('/');
+	itfact::common::checkPath(work_path, true);
+
+	// 운영 Job 서버와 분리하기 위한 전용 Job 서버 실행
+	if (config.isSet("tuner.gearmand")) {
+		gearman_host = "localhost";
+		gearman_port = config.getConfig("tuner.port", default_config.port);
+		std::vector<std::string> args = splitCommand(config.getConfig("tuner.gearmand"));
+		args.push_back("--port");
+		args.push_back(std::to_string(gearman_port));
+		gearmand = spawn(args, std::vector<std::string>());
+		if (gearmand < 0) {
+			logger->error("Cannot execute gearmand: %s", std::strerror(errno));
+			return EXIT_FAILURE;
+		}
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	} else {
+		logger->warn("tuner.gearmand is not set. Jobs are sent to %s:%lu, "
+					 "make sure no other vr_stt worker is registered", gearman_host.c_str(), gearman_port);
+	}
+
+	std::vector<unsigned long> engine_cores =
+		parseList(config.getConfig("tuner.engine_core", default_config.engine_core.c_str()));
+	std::vector<unsigned long> mini_batches =
+		parseList(config.getConfig("tuner.mini_batch", default_config.mini_batch.c_str()));
+	std::vector<unsigned long> stt_workers =
+		parseList(config.getConfig("tuner.stt_worker", default_config.stt_worker.c_str()));
+	std::vector<unsigned long> realtime_workers =
+		parseList(config.getConfig("tuner.realtime_worker", default_config.realtime_worker.c_str()));
+	const unsigned long cores = std::max(1u, std::thread::hardware_concurrency());
+
+	logger->info("Corpus: %lu files, %lu cores", corpus.size(), cores);
+
+	std::vector<tune_result_t> batch_results;
+	std::vector<tune_result_t> realtime_results;
+	const tune_result_t *best_batch = NULL;
+	const tune_result_t *best_realtime = NULL;
+	int run_count = 0;
+
+	// 1단계: 파일 단위 STT
+	for (auto engine_core : engine_cores) {
+		if (engine_core > cores) {
+			logger->warn("Skip engine_core=%lu (only %lu cores)", engine_core, cores);
+			continue;
+		}
+
+		for (auto mini_batch : mini_batches) {
+			for (auto stt_worker : stt_workers) {
+				tune_candidate_t candidate = {engine_core, mini_batch, stt_worker, 0, true};
+				tune_result_t result;
+				std::memset(&result, 0, sizeof(result));
+				result.candidate = candidate;
+
+				std::string config_file = work_path + "env_" + std::to_string(++run_count) + ".conf";
+				if (!writeConfig(candidate, config_file))
+					return EXIT_FAILURE;
+
+				pid_t pid = startServer(candidate, config_file);
+				if (pid < 0)
+					return EXIT_FAILURE;
+				measureBatch(candidate, result);
+				stopServer(pid);
+
+				logger->info("engine_core=%lu, mini_batch=%lu, stt.worker=%lu: "
+							 "RTF %.3f, %.2fx, p50 %.2fs, p95 %.2fs, failed %lu",
+							 engine_core, mini_batch, stt_worker, result.rtf, result.throughput,
+							 result.latency_p50, result.latency_p95, result.failed);
+				batch_results.push_back(result);
+			}
+		}
+	}
+
+	for (auto &&result : batch_results) {
+		if (!result.valid)
+			continue;
+		if (!best_batch || result.throughput > best_batch->throughput ||
+			(result.throughput == best_batch->throughput && result.latency_p95 < best_batch->latency_p95))
+			best_batch = &result;
+	}
+
+	// 2단계: 실시간 STT
+	if (best_batch && !realtime_workers.empty()) {
+		std::sort(realtime_workers.begin(), realtime_workers.end());
+		const bool compare = config.getConfig<bool>("tuner.realtime_compare", false);
+		for (auto realtime_worker : realtime_workers) {
+			if (realtime_worker == 0)
+				continue;
+
+			bool valid = true;
+			for (int mode = 0; mode < (compare ? 2 : 1); ++mode) {
+				tune_candidate_t candidate = {best_batch->candidate.engine_core,
+											  best_batch->candidate.mini_batch, 0, realtime_worker, mode == 0};
+				tune_result_t result;
+				std::memset(&result, 0, sizeof(result));
+				result.candidate = candidate;
+
+				std::string config_file = work_path + "env_" + std::to_string(++run_count) + ".conf";
+				if (!writeConfig(candidate, config_file))
+					return EXIT_FAILURE;
+
+				pid_t pid = startServer(candidate, config_file);
+				if (pid < 0)
+					return EXIT_FAILURE;
+				measureRealtime(candidate, pid, result);
+				stopServer(pid);
+
+				logger->info("realtime.worker=%lu (%s): p50 %.1fms, p95 %.1fms, cpu %.3fs/s, failed %lu%s",
+							 realtime_worker, candidate.incremental ? "incremental" : "packet",
+							 result.latency_p50 * 1000, result.latency_p95 * 1000, result.cpu,
+							 result.failed, result.valid ? "" : " (not realtime)");
+				realtime_results.push_back(result);
+				if (mode == 0)
+					valid = result.valid;
+			}
+			if (compare) {
+				const tune_result_t &incremental = realtime_results[realtime_results.size() - 2];
+				const tune_result_t &packet = realtime_results.back();
+				logger->info("realtime.worker=%lu: incremental vs packet p50 %+.1f%%, p95 %+.1f%%, cpu %+.1f%%",
+							 realtime_worker, change(packet.latency_p50, incremental.latency_p50),
+							 change(packet.latency_p95, incremental.latency_p95),
+							 change(packet.cpu, incremental.cpu));
+			}
+			if (!valid)
+				break;
+		}
+
+		for (auto &&result : realtime_results) {
+			if (result.valid && result.candidate.incremental)
+				best_realtime = &result;
+		}
+	}
+
+	if (!best_batch)
+		logger->error("No valid configuration");
+
+	return writeRecommendation(batch_results, realtime_results, best_batch, best_realtime);
+}
@@ -0,0 +1,92 @@
+/**
+ * @headerfile	tuner.hpp "tuner.hpp"
+ * @file	tuner.hpp
+ * @brief	처리량 자동 튜너
+ * @details	샘플 녹취를 대상으로 stt.engine_core, stt.mini_batch, stt.worker, realtime.worker
+ 			조합별 RTF, 처리량, 지연 시간을 측정하여 권장 설정을 생성한다.\n
+ 			실시간 STT는 패킷 사이에 디코딩 상태를 유지하는 방식과 패킷마다 디코딩하는 방식의
+ 			지연 시간과 CPU 사용량을 비교할 수 있다. (tuner.realtime_compare)
+ * @date	2026. 10. 18. 10:05:12
+ * @see		vr_server.cc
+ */
+
+#ifndef __ITFACT_VR_TUNER_H__
+#define __ITFACT_VR_TUNER_H__
+
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+#include "configuration.hpp"
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/// 측정 대상 설정 조합
+			typedef struct {
+				unsigned long engine_core;		///< stt.engine_core
+				unsigned long mini_batch;		///< stt.mini_batch
+				unsigned long stt_worker;		///< stt.worker
+				unsigned long realtime_worker;	///< realtime.worker
+				bool incremental;				///< realtime.incremental
+			} tune_candidate_t;
+
+			/// 조합별 측정 결과
+			typedef struct {
+				tune_candidate_t candidate;
+				bool valid;					///< 측정 완료 여부
+				std::size_t jobs;			///< 처리한 작업 수
+				std::size_t failed;			///< 실패한 작업 수
+				double audio_seconds;		///< 처리한 녹취 길이 (초)
+				double elapsed;				///< 전체 처리 시간 (초)
+				double rtf;					///< 평균 RTF (처리 시간 / 녹취 길이)
+				double throughput;			///< 처리 배속 (녹취 길이 / 전체 처리 시간)
+				double latency_p50;			///< 작업 지연 시간 p50 (초)
+				double latency_p95;			///< 작업 지연 시간 p95 (초)
+				double cpu;					///< 녹취 1초당 서버 CPU 시간 (초, 실시간 측정)
+			} tune_result_t;
+
+			/// 샘플 녹취
+			typedef struct {
+				std::string pathname;
+				bool is_wave;
+				double seconds;
+			} tune_sample_t;
+
+			/**
+			 * @brief	VR 서버를 설정별로 실행하며 처리량을 측정하는 튜너
+			 */
+			class VRTuner
+			{
+			private:
+				itfact::common::Configuration config;
+				log4cpp::Category *logger;
+				std::vector<tune_sample_t> corpus;
+				std::string work_path;
+				std::string gearman_host;
+				unsigned long gearman_port;
+				pid_t gearmand = -1;
+
+			public:
+				VRTuner(const int argc, const char *argv[]);
+				~VRTuner();
+				int run();
+
+			private:
+				VRTuner();
+				bool loadCorpus(const std::string &path);
+				bool writeConfig(const tune_candidate_t &candidate, const std::string &pathname);
+				pid_t startServer(const tune_candidate_t &candidate, const std::string &config_file);
+				void stopServer(pid_t pid);
+				bool measureBatch(const tune_candidate_t &candidate, tune_result_t &result);
+				bool measureRealtime(const tune_candidate_t &candidate, const pid_t pid, tune_result_t &result);
+				int writeRecommendation(const std::vector<tune_result_t> &batch,
+										const std::vector<tune_result_t> &realtime,
+										const tune_result_t *best_batch,
+										const tune_result_t *best_realtime);
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_TUNER_H__ */
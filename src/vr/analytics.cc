@@ -0,0 +1,239 @@
+/**
+ * @file	analytics.cc
+ * @brief	통화 분석 지표
+ * @details
+ * @date	2026. 10. 19. 01:12:33
+ * @see		analytics.hpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "analytics.hpp"
+
+using namespace itfact::vr::node;
+
+/// 음성 프레임 뒤에 음성으로 유지할 프레임 수 (단어 사이의 짧은 휴지)
+static const std::size_t HANGOVER_FRAMES = 20;
+
+/**
+ * @param[in]	threshold	음성으로 판단하는 최소 에너지 (dB)
+ * @param[in]	margin		잡음 수준보다 커야 하는 에너지 (dB)
+ */
+SpeechAnalytics::SpeechAnalytics(const double threshold, const double margin)
+: threshold(threshold), margin(margin), floor(threshold - margin) {
+}
+
+/**
+ * @brief		PCM 구간 추가
+ * @details		프레임 크기로 나누어 떨어지지 않는 나머지는 다음 구간과 합쳐서 처리한다.
+ * @param[in]	pcm		8kHz 16bit PCM
+ * @param[in]	size	샘플 수
+ */
+void SpeechAnalytics::append(const short *pcm, const std::size_t size) {
+	std::size_t offset = 0;
+	samples += size;
+
+	if (carry_size > 0) {
+		std::size_t length = std::min(ANALYTICS_FRAME - carry_size, size);
+		std::memcpy(carry + carry_size, pcm, length * sizeof(short));
+		carry_size += length;
+		offset = length;
+		if (carry_size < ANALYTICS_FRAME)
+			return;
+		frame(carry);
+		carry_size = 0;
+	}
+
+	for (; offset + ANALYTICS_FRAME <= size; offset += ANALYTICS_FRAME)
+		frame(pcm + offset);
+
+	carry_size = size - offset;
+	if (carry_size > 0)
+		std::memcpy(carry, pcm + offset, carry_size * sizeof(short));
+}
+
+void SpeechAnalytics::frame(const short *pcm) {
+	double energy = 0;
+	for (std::size_t i = 0; i < ANALYTICS_FRAME; ++i)
+		energy += static_cast<double>(pcm[i]) * pcm[i];
+	const double db = 10.0 * std::log10(energy / ANALYTICS_FRAME + 1.0);
+
+	const bool voiced = db > std::max(threshold, floor + margin);
+
+	// 잡음 수준은 바로 내려가고, 음성 구간에서는 긴 발화에 따라가지 않도록 아주 천천히 올라감
+	if (db < floor)
+		floor = db;
+	else
+		floor += (db - floor) * (voiced ? 0.0005 : 0.05);
+
+	if (voiced)
+		hangover = HANGOVER_FRAMES;
+	else if (hangover > 0)
+		--hangover;
+	else {
+		speech.push_back(0);
+		return;
+	}
+	speech.push_back(1);
+}
+
+std::size_t SpeechAnalytics::getSpeechFrames() const {
+	return static_cast<std::size_t>(std::count(speech.begin(), speech.end(), 1));
+}
+
+/**
+ * @param[in]	trailing	발화를 끝내는 묵음 프레임 수 (10ms)
+ * @param[in]	min_speech	발화로 인정하는 최소 음성 프레임 수 (10ms)
+ */
+Endpointer::Endpointer(const std::size_t trailing, const std::size_t min_speech)
+: trailing(trailing ? trailing : 1), min_speech(min_speech) {
+}
+
+/**
+ * @brief		PCM 구간을 추가하고 끝난 발화를 찾음
+ * @date		2026. 10. 19. 05:58:31
+ * @param[in]	pcm		8kHz 16bit PCM
+ * @param[in]	size	샘플 수
+ * @param[out]	ends	이 구간에서 끝난 발화의 끝 프레임 (마지막 음성 프레임 다음, 통화 시작 기준)
+ */
+void Endpointer::append(const short *pcm, const std::size_t size, std::vector<std::size_t> &ends) {
+	ends.clear();
+	vad.append(pcm, size);
+
+	const std::vector<uint8_t> &frames = vad.getSpeech();
+	for (; checked < frames.size(); ++checked) {
+		if (frames[checked]) {
+			++speech;
+			silence = 0;
+			continue;
+		}
+
+		if (++silence == trailing && speech >= min_speech)
+			ends.push_back(checked + 1 - trailing);
+		if (silence >= trailing)
+			speech = 0;
+	}
+}
+
+void Endpointer::reset() {
+	vad = SpeechAnalytics();
+	checked = speech = silence = 0;
+}
+
+LatencyHistogram::LatencyHistogram()
+: buckets(new std::atomic<uint64_t>[BUCKETS]), count(0), sum(0) {
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+		buckets[i].store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::add(const double ms) {
+	const std::size_t bucket = ms > 0 ? static_cast<std::size_t>(ms / 10) : 0;
+	buckets[std::min(bucket, BUCKETS - 1)].fetch_add(1, std::memory_order_relaxed);
+	count.fetch_add(1, std::memory_order_relaxed);
+	sum.fetch_add(static_cast<uint64_t>(ms > 0 ? ms : 0), std::memory_order_relaxed);
+}
+
+/**
+ * @brief		백분위수 (ms, 칸의 상한값)
+ * @param[in]	p	0 ~ 1
+ */
+double LatencyHistogram::percentile(const double p) const {
+	const uint64_t total = count.load(std::memory_order_relaxed);
+	if (total == 0)
+		return 0;
+
+	const uint64_t rank = static_cast<uint64_t>(std::ceil(p * total));
+	uint64_t seen = 0;
+	for (std::size_t i = 0; i < BUCKETS; ++i) {
+		seen += buckets[i].load(std::memory_order_relaxed);
+		if (seen >= rank)
+			return (i + 1) * 10.0;
+	}
+	return BUCKETS * 10.0;
+}
+
+void LatencyHistogram::stats(const std::string &name, std::string &result) const {
+	const uint64_t total = count.load(std::memory_order_relaxed);
+	char buffer[64];
+
+	result.append(name).append(".count\t").append(std::to_string(total)).push_back('\n');
+	std::snprintf(buffer, sizeof(buffer), "%.1f", total ? static_cast<double>(sum.load()) / total : 0.0);
+	result.append(name).append(".mean_ms\t").append(buffer).push_back('\n');
+	const double points[] = {0.5, 0.9, 0.95, 0.99};
+	for (auto &&p : points) {
+		std::snprintf(buffer, sizeof(buffer), ".p%d_ms\t%.0f\n", static_cast<int>(p * 100), percentile(p));
+		result.append(name).append(buffer);
+	}
+}
+
+/**
+ * @brief		셀 데이터의 단어 수
+ * @details		<s>, </s> 등 '<'로 시작하는 기호는 제외한다.
+ */
+std::size_t itfact::vr::node::countWords(const char *cell_data, const std::size_t size) {
+	std::size_t words = 0;
+	const char *end = cell_data + size;
+	for (const char *line = cell_data; line < end; ) {
+		const char *eol = static_cast<const char *>(std::memchr(line, '\n', end - line));
+		if (!eol)
+			eol = end;
+
+		// <시작>\t<끝>\t<단어>
+		const char *p = static_cast<const char *>(std::memchr(line, '\t', eol - line));
+		if (p && (p = static_cast<const char *>(std::memchr(p + 1, '\t', eol - p - 1))) != NULL &&
+			p + 1 < eol && p[1] != '<' && p[1] != '\t')
+			++words;
+
+		line = eol + 1;
+	}
+	return words;
+}
+
+/**
+ * @brief		분석 지표를 "\t<이름>=<값>" 형식으로 추가
+ * @details		duration: 길이(초), talk: 채널별 발화 비율, silence: 모든 채널이 묵음인 비율,
+ 			overtalk: 두 채널이 동시에 발화한 비율(2채널), rate: 발화 시간(초)당 단어 수
+ * @date		2026. 10. 19. 01:24:50
+ * @param[out]	result		결과 (뒤에 추가)
+ * @param[in]	channels	채널별 음성 구간
+ * @param[in]	words		전체 단어 수
+ */
+void itfact::vr::node::appendAnalytics(std::string &result, const std::vector<const SpeechAnalytics *> &channels,
+									   const std::size_t words) {
+	std::size_t frames = 0;
+	for (auto &&channel : channels)
+		frames = std::max(frames, channel->getFrames());
+	if (channels.empty() || frames == 0)
+		return;
+
+	std::size_t silence = 0, overtalk = 0, talk_frames = 0;
+	for (std::size_t i = 0; i < frames; ++i) {
+		std::size_t speakers = 0;
+		for (auto &&channel : channels)
+			speakers += i < channel->getFrames() && channel->getSpeech()[i];
+		silence += speakers == 0;
+		overtalk += speakers > 1;
+		talk_frames += speakers > 0;
+	}
+
+	char buffer[64];
+	std::snprintf(buffer, sizeof(buffer), "\tduration=%.2f", frames / 100.0);
+	result.append(buffer);
+	result.append("\ttalk=");
+	for (std::size_t i = 0; i < channels.size(); ++i) {
+		std::snprintf(buffer, sizeof(buffer), i ? ",%.3f" : "%.3f",
+					  static_cast<double>(channels[i]->getSpeechFrames()) / frames);
+		result.append(buffer);
+	}
+	std::snprintf(buffer, sizeof(buffer), "\tsilence=%.3f", static_cast<double>(silence) / frames);
+	result.append(buffer);
+	if (channels.size() > 1) {
+		std::snprintf(buffer, sizeof(buffer), "\tovertalk=%.3f", static_cast<double>(overtalk) / frames);
+		result.append(buffer);
+	}
+	std::snprintf(buffer, sizeof(buffer), "\trate=%.2f", talk_frames ? words * 100.0 / talk_frames : 0.0);
+	result.append(buffer);
+}
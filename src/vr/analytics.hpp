@@ -0,0 +1,103 @@
+/**
+ * @headerfile	analytics.hpp "analytics.hpp"
+ * @file	analytics.hpp
+ * @brief	통화 분석 지표
+ * @details	STT를 수행하면서 FrontEnd에 넣는 PCM 구간의 프레임(10ms) 에너지로 음성 구간을 판별하고,
+ 			인식 결과의 단어 수와 함께 발화/묵음 비율, 동시 발화(overtalk) 비율, 발화 속도를 계산한다.\n
+ 			실시간 STT에서는 같은 음성 구간 검출로 발화의 끝을 찾아(Endpointer) 발화마다 최종 결과를 낸다.
+ * @date	2026. 10. 19. 01:12:33
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_ANALYTICS_H__
+#define __ITFACT_VR_ANALYTICS_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			static const std::size_t ANALYTICS_FRAME = 80;	///< 8kHz 10ms
+
+			/**
+			 * @brief	채널별 음성 구간 검출 (에너지 기반)
+			 */
+			class SpeechAnalytics
+			{
+			private:
+				double threshold;	///< 음성으로 판단하는 최소 에너지 (dB)
+				double margin;		///< 잡음 수준보다 커야 하는 에너지 (dB)
+				double floor;		///< 잡음 수준 (dB)
+				std::size_t hangover = 0;
+				std::size_t samples = 0;
+				std::vector<uint8_t> speech;	///< 프레임별 음성 여부
+				short carry[ANALYTICS_FRAME];
+				std::size_t carry_size = 0;
+
+			public:
+				explicit SpeechAnalytics(const double threshold = 45.0, const double margin = 12.0);
+
+				void append(const short *pcm, const std::size_t size);
+				std::size_t getSamples() const {return samples;};
+				std::size_t getFrames() const {return speech.size();};
+				std::size_t getSpeechFrames() const;
+				const std::vector<uint8_t> &getSpeech() const {return speech;};
+
+			private:
+				void frame(const short *pcm);
+			};
+
+			/**
+			 * @brief	발화 끝 검출 (실시간 STT)
+			 * @details	음성 구간이 min_speech 프레임 이상 이어진 후 묵음이 trailing 프레임 이상 이어지면 발화가 끝난 것으로 본다.
+			 */
+			class Endpointer
+			{
+			private:
+				SpeechAnalytics vad;
+				std::size_t trailing;		///< 발화를 끝내는 묵음 프레임 수
+				std::size_t min_speech;		///< 발화로 인정하는 최소 음성 프레임 수
+				std::size_t checked = 0;	///< 검사한 프레임 수
+				std::size_t speech = 0;		///< 현재 발화의 음성 프레임 수
+				std::size_t silence = 0;	///< 현재 이어지는 묵음 프레임 수
+
+			public:
+				Endpointer(const std::size_t trailing, const std::size_t min_speech);
+
+				void append(const short *pcm, const std::size_t size, std::vector<std::size_t> &ends);
+				std::size_t getFrames() const {return vad.getFrames();};
+				std::size_t getTrailing() const {return trailing;};
+				void reset();
+			};
+
+			/**
+			 * @brief	지연 시간 분포 (10ms 단위, 잠금 없음)
+			 */
+			class LatencyHistogram
+			{
+			private:
+				static const std::size_t BUCKETS = 1000;	///< 10초까지, 그 이상은 마지막 칸
+				std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+				std::atomic<uint64_t> count;
+				std::atomic<uint64_t> sum;
+
+			public:
+				LatencyHistogram();
+
+				void add(const double ms);
+				double percentile(const double p) const;
+				void stats(const std::string &name, std::string &result) const;
+			};
+
+			std::size_t countWords(const char *cell_data, const std::size_t size);
+			void appendAnalytics(std::string &result, const std::vector<const SpeechAnalytics *> &channels,
+								 const std::size_t words);
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_ANALYTICS_H__ */
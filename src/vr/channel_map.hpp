@@ -0,0 +1,353 @@
+/**
+ * @headerfile	channel_map.hpp "channel_map.hpp"
+ * @file	channel_map.hpp
+ * @brief	실시간 STT 채널 관리
+ * @details	통화 ID별로 RealtimeSTT를 연결하여 같은 통화의 패킷이 항상 같은 디코더에서 처리되도록 한다.\n
+ 			잠금 경합을 줄이기 위해 통화 ID의 해시로 나눈 shard마다 연결을 따로 유지한다.
+ 			LAST 패킷으로 끝나거나 idle_timeout 동안 패킷이 없는 통화의 채널은 초기화한 후 여분 채널로 보관하여
+ 			다음 통화에서 다시 생성하지 않고 사용한다.
+ 			여분 채널은 잠금 없는 MPMC 큐에 보관하므로 새 통화가 채널을 받을 때 다른 통화와 경합하지 않는다.\n
+ 			채널과 여분 채널 목록은 템플릿 인자이므로 디코더 없이 벤치마크할 수 있다. (channel_bench)
+ * @date	2026. 10. 19. 04:31:27
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_CHANNEL_MAP_H__
+#define __ITFACT_VR_CHANNEL_MAP_H__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <log4cpp/Category.hh>
+
+#include "configuration.hpp"
+#include "mpmc_queue.hpp"
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			class RealtimeSTT;
+
+			/**
+			 * @brief	통화 ID -> 채널 (sharded)
+			 * @details	CHANNEL은 reset()으로 새 통화를 위해 초기화한다.\n
+			 			SPARES는 여분 채널 목록이며 생성자(최대 개수), push(), pop(), size()를
+			 			itfact::common::MPMCQueue와 같은 의미로 제공해야 한다.
+			 */
+			template <typename CHANNEL, typename SPARES = itfact::common::MPMCQueue<std::shared_ptr<CHANNEL>>>
+			class BasicChannelMap
+			{
+			public:
+				/// 채널 생성 (인자: 채널 번호)
+				typedef std::function<std::shared_ptr<CHANNEL>(const std::size_t)> factory_t;
+
+			private:
+				typedef struct {
+					std::shared_ptr<CHANNEL> node;
+					bool busy;				///< 패킷 처리 중
+					std::chrono::steady_clock::time_point last_used;
+				} entry_t;
+				typedef struct {
+					std::mutex lock;
+					std::unordered_map<std::string, entry_t> calls;
+				} shard_t;
+
+				log4cpp::Category *logger;
+				factory_t factory;
+				std::vector<std::unique_ptr<shard_t>> shards;
+				std::size_t capacity;		///< 최대 채널 수 (0: 제한 없음)
+				std::chrono::seconds idle_timeout;
+
+				SPARES spares;				///< 초기화된 여분 채널
+				std::atomic<std::size_t> total;		///< 생성된 채널 수 (연결 + 여분)
+
+				std::mutex lock;
+				std::condition_variable cond;
+				bool running = true;
+				std::thread evictor;
+
+				std::atomic<uint64_t> created;
+				std::atomic<uint64_t> reused;
+				std::atomic<uint64_t> evicted;
+				std::atomic<uint64_t> rejected;
+
+			public:
+				/**
+				 * @brief		채널 관리자 생성
+				 * @details		idle_timeout이 0이 아니면 오래 사용하지 않은 통화를 정리하는 스레드를 시작한다.
+				 * @date		2026. 10. 19. 04:38:02
+				 * @param[in]	factory		채널 생성 함수
+				 * @param[in]	count		shard 수 (0이면 1)
+				 * @param[in]	capacity	최대 채널 수 (0: 제한 없음)
+				 * @param[in]	spare_size	보관할 최대 여분 채널 수 (0이면 1)
+				 * @param[in]	idle_timeout	패킷 없이 채널을 유지하는 시간 (0: 정리하지 않음)
+				 */
+				BasicChannelMap(const factory_t &factory, const std::size_t count, const std::size_t capacity,
+								const std::size_t spare_size, const std::chrono::seconds idle_timeout,
+								log4cpp::Category *logger = &log4cpp::Category::getRoot())
+				: logger(logger), factory(factory), capacity(capacity), idle_timeout(idle_timeout),
+				  spares(spare_size ? spare_size : 1), total(0), created(0), reused(0), evicted(0), rejected(0) {
+					const std::size_t n = count ? count : 1;
+					for (std::size_t i = 0; i < n; ++i)
+						shards.push_back(std::unique_ptr<shard_t>(new shard_t));
+
+					if (idle_timeout.count() > 0)
+						evictor = std::thread(&BasicChannelMap::run, this);
+				}
+
+				~BasicChannelMap() {
+					{
+						std::lock_guard<std::mutex> guard(lock);
+						running = false;
+					}
+					cond.notify_all();
+					if (evictor.joinable())
+						evictor.join();
+
+					for (auto &&shard : shards) {
+						std::lock_guard<std::mutex> guard(shard->lock);
+						shard->calls.clear();
+					}
+				}
+
+				/**
+				 * @brief		여분 채널 미리 생성
+				 * @details		capacity와 spare_size를 넘지 않는다.
+				 * @param[in]	count	생성할 채널 수
+				 * @return		생성된 채널 수
+				 */
+				std::size_t reserve(const std::size_t count) {
+					std::size_t done = 0;
+					for (std::size_t number; done < count && reserveNumber(number); ++done) {
+						std::shared_ptr<CHANNEL> node = factory(number);
+						if (!node || !spares.push(node)) {
+							--total;
+							break;
+						}
+						++created;
+					}
+					return done;
+				}
+
+				/**
+				 * @brief		통화의 채널 사용 시작
+				 * @details		통화에 연결된 채널이 없으면 여분 채널이나 새로 생성한 채널을 연결한다.
+				 			새로 연결된 채널은 초기화된 상태이다.
+				 * @date		2026. 10. 19. 04:42:15
+				 * @param[in]	call_id		Call ID
+				 * @return		채널. 같은 통화의 다른 패킷을 처리 중이거나 채널이 없으면 nullptr
+				 * @see			release()
+				 */
+				std::shared_ptr<CHANNEL> acquire(const std::string &call_id) {
+					shard_t &shard = getShard(call_id);
+					{
+						std::lock_guard<std::mutex> guard(shard.lock);
+						auto search = shard.calls.find(call_id);
+						if (search != shard.calls.end()) {
+							if (search->second.busy) {
+								logger->error("[0x%X] Call %s is already running" LOG_FMT, THREAD_ID, call_id.c_str(),
+											  LOG_INFO);
+								return nullptr;
+							}
+							search->second.busy = true;
+							return search->second.node;
+						}
+					}
+
+					// 채널 생성은 오래 걸리므로 shard를 잠그지 않음
+					std::shared_ptr<CHANNEL> node = allocate();
+					if (!node)
+						return nullptr;
+
+					std::shared_ptr<CHANNEL> current;
+					{
+						std::lock_guard<std::mutex> guard(shard.lock);
+						entry_t entry = {node, true, std::chrono::steady_clock::now()};
+						auto result = shard.calls.insert(std::make_pair(call_id, entry));
+						if (result.second)
+							return node;
+
+						// 같은 통화의 다른 패킷이 먼저 연결
+						if (!result.first->second.busy) {
+							result.first->second.busy = true;
+							current = result.first->second.node;
+						}
+					}
+
+					recycle(node);
+					if (!current)
+						logger->error("[0x%X] Call %s is already running" LOG_FMT, THREAD_ID, call_id.c_str(), LOG_INFO);
+					return current;
+				}
+
+				/**
+				 * @brief		통화의 채널 사용 종료
+				 * @param[in]	call_id		Call ID
+				 * @param[in]	node		acquire()로 받은 채널
+				 * @param[in]	close		통화 종료 여부 (true: 채널을 초기화하여 여분 채널로 보관)
+				 */
+				void release(const std::string &call_id, const std::shared_ptr<CHANNEL> &node, const bool close) {
+					shard_t &shard = getShard(call_id);
+					{
+						std::lock_guard<std::mutex> guard(shard.lock);
+						auto search = shard.calls.find(call_id);
+						if (search == shard.calls.end() || search->second.node != node)
+							return;
+
+						if (!close) {
+							search->second.busy = false;
+							search->second.last_used = std::chrono::steady_clock::now();
+							return;
+						}
+						shard.calls.erase(search);
+					}
+
+					recycle(node);
+				}
+
+				void stats(std::string &result) {
+					std::size_t calls = 0, busy = 0;
+					for (auto &&shard : shards) {
+						std::lock_guard<std::mutex> guard(shard->lock);
+						calls += shard->calls.size();
+						for (auto &&entry : shard->calls)
+							busy += entry.second.busy;
+					}
+
+					result.append("realtime.channels.shards\t").append(std::to_string(shards.size())).push_back('\n');
+					result.append("realtime.channels.calls\t").append(std::to_string(calls)).push_back('\n');
+					result.append("realtime.channels.busy\t").append(std::to_string(busy)).push_back('\n');
+					result.append("realtime.channels.spare\t").append(std::to_string(spares.size())).push_back('\n');
+					result.append("realtime.channels.total\t").append(std::to_string(total.load())).push_back('\n');
+					result.append("realtime.channels.capacity\t").append(std::to_string(capacity)).push_back('\n');
+					result.append("realtime.channels.created\t").append(std::to_string(created)).push_back('\n');
+					result.append("realtime.channels.reused\t").append(std::to_string(reused)).push_back('\n');
+					result.append("realtime.channels.evicted\t").append(std::to_string(evicted)).push_back('\n');
+					result.append("realtime.channels.rejected\t").append(std::to_string(rejected)).push_back('\n');
+				}
+
+			private:
+				BasicChannelMap();
+
+				shard_t &getShard(const std::string &key) {
+					return *shards[std::hash<std::string>()(key) % shards.size()];
+				}
+
+				/**
+				 * @brief		capacity 안에서 새 채널 번호 할당
+				 * @return		capacity만큼 생성되어 있으면 false
+				 */
+				bool reserveNumber(std::size_t &number) {
+					number = total.load(std::memory_order_relaxed);
+					do {
+						if (capacity && number >= capacity)
+							return false;
+					} while (!total.compare_exchange_weak(number, number + 1));
+					return true;
+				}
+
+				/**
+				 * @brief		채널 할당
+				 * @details		여분 채널을 먼저 사용하고, 없으면 capacity 안에서 새로 생성한다.
+				 */
+				std::shared_ptr<CHANNEL> allocate() {
+					std::shared_ptr<CHANNEL> node;
+					std::size_t number;
+					for (;;) {
+						if (spares.pop(node)) {
+							++reused;
+							return node;
+						}
+						if (reserveNumber(number))
+							break;
+
+						// 다른 스레드가 넣는 중인 여분 채널은 넣기가 끝날 때까지 보이지 않음
+						if (spares.size() == 0) {
+							++rejected;
+							return nullptr;
+						}
+						std::this_thread::yield();
+					}
+
+					node = factory(number);
+					if (!node) {
+						--total;
+						return nullptr;
+					}
+					++created;
+					return node;
+				}
+
+				/**
+				 * @brief		채널을 초기화하여 여분 채널로 보관
+				 * @details		여분 채널이 spare_size만큼 있으면 삭제한다.
+				 */
+				void recycle(const std::shared_ptr<CHANNEL> &node) {
+					node->reset();
+
+					std::shared_ptr<CHANNEL> spare(node);
+					if (!spares.push(spare))
+						--total;
+				}
+
+				/**
+				 * @brief		idle_timeout 동안 패킷이 없는 통화 정리
+				 * @details		LAST 패킷을 보내지 못하고 끊긴 통화의 채널을 회수한다.
+				 */
+				void evict() {
+					const auto now = std::chrono::steady_clock::now();
+					std::vector<std::pair<std::string, std::shared_ptr<CHANNEL>>> expired;
+
+					for (auto &&shard : shards) {
+						std::lock_guard<std::mutex> guard(shard->lock);
+						for (auto iter = shard->calls.begin(); iter != shard->calls.end();) {
+							if (!iter->second.busy && now - iter->second.last_used >= idle_timeout) {
+								expired.push_back(std::make_pair(iter->first, iter->second.node));
+								iter = shard->calls.erase(iter);
+							} else {
+								++iter;
+							}
+						}
+					}
+
+					for (auto &&item : expired) {
+						logger->warn("[0x%X] Evict idle call %s" LOG_FMT, THREAD_ID, item.first.c_str(), LOG_INFO);
+						recycle(item.second);
+						++evicted;
+					}
+				}
+
+				void run() {
+					const std::chrono::seconds interval(std::max<std::chrono::seconds::rep>(idle_timeout.count() / 2, 1));
+
+					std::unique_lock<std::mutex> guard(lock);
+					while (running) {
+						cond.wait_for(guard, interval);
+						if (!running)
+							break;
+
+						guard.unlock();
+						evict();
+						guard.lock();
+					}
+				}
+			};
+
+			/// 실시간 STT 채널 관리자
+			typedef BasicChannelMap<RealtimeSTT> ChannelMap;
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_CHANNEL_MAP_H__ */
@@ -0,0 +1,323 @@
+/**
+ * @file	feature_store.cc
+ * @brief	특징 벡터 저장소
+ * @details
+ * @date	2026. 10. 18. 17:15:20
+ * @see		feature_store.hpp
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "feature_store.hpp"
+
+using namespace itfact::vr::node;
+
+static const char FEATURE_MAGIC[8] = "VRFEAT1";
+static const uint32_t FEATURE_VERSION = 1;
+
+/// 열별 백분위 값 (CompressedMatrix::PerColHeader)
+typedef struct {
+	uint16_t percentile_0;
+	uint16_t percentile_25;
+	uint16_t percentile_75;
+	uint16_t percentile_100;
+} feature_col_t;
+
+static inline std::size_t align4(const std::size_t size) {
+	return (size + 3) & ~static_cast<std::size_t>(3);
+}
+
+static inline uint16_t floatToUint16(const float min_value, const float range, const float value) {
+	float f = (value - min_value) / range;
+	if (f > 1.0f) f = 1.0f;
+	if (f < 0.0f) f = 0.0f;
+	return static_cast<uint16_t>(f * 65535 + 0.499);
+}
+
+static inline float uint16ToFloat(const float min_value, const float range, const uint16_t value) {
+	return min_value + range * 1.52590218966964e-05F * value;
+}
+
+static inline unsigned char floatToChar(const float p0, const float p25, const float p75, const float p100,
+										const float value) {
+	int ans;
+	if (value < p25) {
+		ans = static_cast<int>((value - p0) / (p25 - p0) * 64 + 0.5);
+		ans = std::min(std::max(ans, 0), 64);
+	} else if (value < p75) {
+		ans = 64 + static_cast<int>((value - p25) / (p75 - p25) * 128 + 0.5);
+		ans = std::min(std::max(ans, 64), 192);
+	} else {
+		ans = 192 + static_cast<int>((value - p75) / (p100 - p75) * 63 + 0.5);
+		ans = std::min(std::max(ans, 192), 255);
+	}
+	return static_cast<unsigned char>(ans);
+}
+
+static inline float charToFloat(const float p0, const float p25, const float p75, const float p100,
+								const unsigned char value) {
+	if (value <= 64)
+		return p0 + (p25 - p0) * value * (1 / 64.0f);
+	else if (value <= 192)
+		return p25 + (p75 - p25) * (value - 64) * (1 / 128.0f);
+	else
+		return p75 + (p100 - p75) * (value - 192) * (1 / 63.0f);
+}
+
+/**
+ * @brief		저장할 파일 생성
+ * @details		mkstemp()로 만든 임시 파일에 기록한 후 close()에서 이름을 바꾼다.\n
+ 				같은 파일을 여러 작업이 저장하더라도(캐시 적중 후 save_feature()와 디코딩 등) 서로의 임시 파일을 덮어쓰지 않는다.
+ * @date		2026. 10. 18. 17:20:11
+ * @param[in]	pathname	특징 벡터 파일
+ * @param[in]	mfcc_size	프레임 크기 (float 개수)
+ * @param[in]	mini_batch	mini batch
+ * @param[in]	samples		녹취 데이터 길이 (샘플 수)
+ * @param[in]	compress	8bit 압축 여부
+ */
+FeatureWriter::FeatureWriter(const std::string &pathname, const std::size_t mfcc_size,
+							 const std::size_t mini_batch, const std::size_t samples,
+							 const bool compress)
+: pathname(pathname), tmp_pathname(pathname + ".XXXXXX") {
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, FEATURE_MAGIC, sizeof(header.magic));
+	header.version = FEATURE_VERSION;
+	header.format = compress ? FEATURE_COMPRESSED : FEATURE_FLOAT;
+	header.mfcc_size = static_cast<uint32_t>(mfcc_size);
+	header.mini_batch = static_cast<uint32_t>(mini_batch);
+	header.samples = samples;
+
+	const int fd = mkstemp(&tmp_pathname[0]);
+	if (fd < 0)
+		return;
+	// mkstemp()는 0600으로 만들므로 fopen()으로 만들던 때와 같이 다른 사용자도 읽을 수 있게 함
+	fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+	fp = fdopen(fd, "wb");
+	if (!fp) {
+		::close(fd);
+		std::remove(tmp_pathname.c_str());
+		return;
+	}
+	if (std::fwrite(&header, sizeof(header), 1, fp) != 1) {
+		std::fclose(fp);
+		std::remove(tmp_pathname.c_str());
+		fp = NULL;
+	}
+}
+
+/**
+ * @brief		close()가 호출되지 않은 경우 임시 파일 삭제
+ */
+FeatureWriter::~FeatureWriter() {
+	if (fp) {
+		std::fclose(fp);
+		std::remove(tmp_pathname.c_str());
+	}
+}
+
+/**
+ * @brief		한 구간의 특징 벡터 저장
+ * @date		2026. 10. 18. 17:26:30
+ * @param[in]	type	구간 종류
+ * @param[in]	frames	특징 벡터 (nf * mfcc_size)
+ * @param[in]	nf		프레임 수
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int FeatureWriter::write(const enum FEATURE_RECORD type, const float *frames, const std::size_t nf) {
+	if (!fp)
+		return EXIT_FAILURE;
+
+	feature_record_t record;
+	std::memset(&record, 0, sizeof(record));
+	record.nf = static_cast<uint32_t>(nf);
+	record.type = type;
+
+	const void *data = frames;
+	if (header.format == FEATURE_COMPRESSED && nf > 0) {
+		compress(frames, nf, record);
+		data = buffer.data();
+	} else {
+		record.size = static_cast<uint32_t>(sizeof(float) * nf * header.mfcc_size);
+	}
+
+	if (std::fwrite(&record, sizeof(record), 1, fp) != 1 ||
+		(record.size > 0 && std::fwrite(data, record.size, 1, fp) != 1)) {
+		std::fclose(fp);
+		fp = NULL;
+		std::remove(tmp_pathname.c_str());
+		return EXIT_FAILURE;
+	}
+
+	++header.records;
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		8bit 압축
+ * @details		feature_col_t * mfcc_size 다음에 열 단위로 nf byte씩 저장한다.
+ */
+void FeatureWriter::compress(const float *frames, const std::size_t nf, feature_record_t &record) {
+	const std::size_t cols = header.mfcc_size;
+	const std::size_t total = nf * cols;
+
+	float min_value = frames[0];
+	float max_value = frames[0];
+	for (std::size_t i = 1; i < total; ++i) {
+		min_value = std::min(min_value, frames[i]);
+		max_value = std::max(max_value, frames[i]);
+	}
+	float range = max_value - min_value;
+	if (range == 0.0f)
+		range = 1.0f;
+	record.min_value = min_value;
+	record.range = range;
+	record.size = static_cast<uint32_t>(align4(sizeof(feature_col_t) * cols + total));
+
+	buffer.assign(record.size, 0);
+	feature_col_t *col_headers = reinterpret_cast<feature_col_t *>(buffer.data());
+	unsigned char *bytes = buffer.data() + sizeof(feature_col_t) * cols;
+	std::vector<float> column(nf);
+
+	for (std::size_t col = 0; col < cols; ++col) {
+		for (std::size_t row = 0; row < nf; ++row)
+			column[row] = frames[row * cols + col];
+
+		// 0, 25, 75, 100 백분위 (서로 다른 값이 되도록 보정)
+		std::size_t quarter = nf / 4;
+		std::vector<float> sorted(column);
+		std::sort(sorted.begin(), sorted.end());
+		feature_col_t &h = col_headers[col];
+		h.percentile_0 = std::min<uint16_t>(floatToUint16(min_value, range, sorted[0]), 65532);
+		h.percentile_25 = std::min<uint16_t>(std::max<uint16_t>(
+			floatToUint16(min_value, range, sorted[quarter]), h.percentile_0 + 1), 65533);
+		h.percentile_75 = std::min<uint16_t>(std::max<uint16_t>(
+			floatToUint16(min_value, range, sorted[std::min(nf - 1, 3 * quarter)]), h.percentile_25 + 1), 65534);
+		h.percentile_100 = std::max<uint16_t>(
+			floatToUint16(min_value, range, sorted[nf - 1]), h.percentile_75 + 1);
+
+		float p0 = uint16ToFloat(min_value, range, h.percentile_0);
+		float p25 = uint16ToFloat(min_value, range, h.percentile_25);
+		float p75 = uint16ToFloat(min_value, range, h.percentile_75);
+		float p100 = uint16ToFloat(min_value, range, h.percentile_100);
+		for (std::size_t row = 0; row < nf; ++row)
+			bytes[col * nf + row] = floatToChar(p0, p25, p75, p100, column[row]);
+	}
+}
+
+/**
+ * @brief		헤더에 기록 수를 저장하고 파일 이름 변경
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int FeatureWriter::close() {
+	if (!fp)
+		return EXIT_FAILURE;
+
+	bool success = std::fseek(fp, 0, SEEK_SET) == 0 &&
+				   std::fwrite(&header, sizeof(header), 1, fp) == 1;
+	success = (std::fclose(fp) == 0) && success;
+	fp = NULL;
+
+	if (!success || std::rename(tmp_pathname.c_str(), pathname.c_str()) != 0) {
+		std::remove(tmp_pathname.c_str());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		특징 벡터 파일을 메모리에 매핑
+ * @details		저장이 완료되지 않았거나 형식이 다른 파일은 열지 않는다. (isOpen() 확인)
+ * @date		2026. 10. 18. 17:41:52
+ */
+FeatureReader::FeatureReader(const std::string &pathname) {
+	int fd = ::open(pathname.c_str(), O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(feature_header_t)) {
+		::close(fd);
+		return;
+	}
+
+	map_size = static_cast<std::size_t>(st.st_size);
+	map = mmap(NULL, map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (map == MAP_FAILED) {
+		map = NULL;
+		return;
+	}
+	madvise(map, map_size, MADV_SEQUENTIAL);
+
+	const feature_header_t *_header = static_cast<const feature_header_t *>(map);
+	if (std::memcmp(_header->magic, FEATURE_MAGIC, sizeof(FEATURE_MAGIC)) != 0 ||
+		_header->version != FEATURE_VERSION || _header->records == 0 || _header->mfcc_size == 0)
+		return;
+
+	header = _header;
+	position = sizeof(feature_header_t);
+}
+
+FeatureReader::~FeatureReader() {
+	if (map)
+		munmap(map, map_size);
+}
+
+/**
+ * @brief		다음 구간의 특징 벡터를 읽음
+ * @date		2026. 10. 18. 17:48:05
+ * @param[out]	type		구간 종류
+ * @param[out]	frames		특징 벡터 (max_frames * mfcc_size 이상)
+ * @param[in]	max_frames	frames에 저장할 수 있는 프레임 수
+ * @param[out]	nf			프레임 수
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise (파일의 끝이거나 손상된 경우), a EXIT_FAILURE is returned.
+ */
+int FeatureReader::next(enum FEATURE_RECORD &type, float *frames, const std::size_t max_frames, std::size_t &nf) {
+	if (!header || position + sizeof(feature_record_t) > map_size)
+		return EXIT_FAILURE;
+
+	const unsigned char *base = static_cast<const unsigned char *>(map);
+	const feature_record_t *record = reinterpret_cast<const feature_record_t *>(base + position);
+	const unsigned char *data = base + position + sizeof(feature_record_t);
+	const std::size_t cols = header->mfcc_size;
+
+	if (record->nf > max_frames || position + sizeof(feature_record_t) + record->size > map_size)
+		return EXIT_FAILURE;
+
+	nf = record->nf;
+	type = static_cast<enum FEATURE_RECORD>(record->type);
+
+	if (header->format == FEATURE_COMPRESSED && nf > 0) {
+		if (record->size < sizeof(feature_col_t) * cols + nf * cols)
+			return EXIT_FAILURE;
+
+		const feature_col_t *col_headers = reinterpret_cast<const feature_col_t *>(data);
+		const unsigned char *bytes = data + sizeof(feature_col_t) * cols;
+		for (std::size_t col = 0; col < cols; ++col) {
+			const feature_col_t &h = col_headers[col];
+			float p0 = uint16ToFloat(record->min_value, record->range, h.percentile_0);
+			float p25 = uint16ToFloat(record->min_value, record->range, h.percentile_25);
+			float p75 = uint16ToFloat(record->min_value, record->range, h.percentile_75);
+			float p100 = uint16ToFloat(record->min_value, record->range, h.percentile_100);
+			for (std::size_t row = 0; row < nf; ++row)
+				frames[row * cols + col] = charToFloat(p0, p25, p75, p100, bytes[col * nf + row]);
+		}
+	} else {
+		if (record->size != sizeof(float) * nf * cols)
+			return EXIT_FAILURE;
+		std::memcpy(frames, data, record->size);
+	}
+
+	position += sizeof(feature_record_t) + record->size;
+	return EXIT_SUCCESS;
+}
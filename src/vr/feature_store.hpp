@@ -0,0 +1,113 @@
+/**
+ * @headerfile	feature_store.hpp "feature_store.hpp"
+ * @file	feature_store.hpp
+ * @brief	특징 벡터 저장소
+ * @details	FrontEnd(stepFrameLFrontEnd) 출력을 파일로 저장하여 언어 모델이나 빔 설정을 바꿔
+ 			다시 디코딩할 때 특징 추출 없이 stepSARecFrameExt()에 입력할 수 있게 한다.\n
+ 			8bit 압축은 kaldi의 CompressedMatrix와 같이 열별 0, 25, 75, 100 백분위 값을 16bit로 저장하고
+ 			각 값을 3개 구간으로 나눠 1byte로 표현한다.\n
+ 			파일 구성: feature_header_t, (feature_record_t, 데이터)*
+ * @date	2026. 10. 18. 17:02:45
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_FEATURE_STORE_H__
+#define __ITFACT_VR_FEATURE_STORE_H__
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			enum FEATURE_FORMAT {
+				FEATURE_FLOAT = 0,		///< float32
+				FEATURE_COMPRESSED = 1	///< 열별 백분위 기반 8bit
+			};
+
+			enum FEATURE_RECORD {
+				FEATURE_FIRST = 0,		///< 첫 번째 구간 (LDA 프레임 스택 포함)
+				FEATURE_CHUNK = 1,		///< 일반 구간 (reset_period 확인)
+				FEATURE_FLUSH = 2		///< FrontEnd 내부 버퍼
+			};
+
+			/// 파일 헤더
+			typedef struct {
+				char magic[8];			///< "VRFEAT1"
+				uint32_t version;
+				uint32_t format;		///< FEATURE_FORMAT
+				uint32_t mfcc_size;
+				uint32_t mini_batch;
+				uint64_t samples;		///< 녹취 데이터 길이 (샘플 수)
+				uint64_t records;		///< 기록 수 (0: 저장이 완료되지 않음)
+				uint8_t reserved[24];
+			} feature_header_t;
+
+			/// 구간 헤더 (4byte 단위로 정렬됨)
+			typedef struct {
+				uint32_t nf;			///< 프레임 수
+				uint32_t type;			///< FEATURE_RECORD
+				uint32_t size;			///< 데이터 크기 (bytes)
+				float min_value;		///< 압축 시 최소값
+				float range;			///< 압축 시 범위
+			} feature_record_t;
+
+			/**
+			 * @brief	특징 벡터 저장
+			 */
+			class FeatureWriter
+			{
+			private:
+				std::string pathname;
+				std::string tmp_pathname;
+				std::FILE *fp = NULL;
+				feature_header_t header;
+				std::vector<unsigned char> buffer;
+
+			public:
+				FeatureWriter(const std::string &pathname, const std::size_t mfcc_size,
+							  const std::size_t mini_batch, const std::size_t samples,
+							  const bool compress);
+				~FeatureWriter();
+
+				bool isOpen() const {return fp != NULL;};
+				int write(const enum FEATURE_RECORD type, const float *frames, const std::size_t nf);
+				int close();
+
+			private:
+				FeatureWriter();
+				void compress(const float *frames, const std::size_t nf, feature_record_t &record);
+			};
+
+			/**
+			 * @brief	특징 벡터 읽기 (mmap)
+			 */
+			class FeatureReader
+			{
+			private:
+				void *map = NULL;
+				std::size_t map_size = 0;
+				std::size_t position = 0;
+				const feature_header_t *header = NULL;
+
+			public:
+				explicit FeatureReader(const std::string &pathname);
+				~FeatureReader();
+
+				bool isOpen() const {return header != NULL;};
+				std::size_t getMfccSize() const {return header->mfcc_size;};
+				std::size_t getMiniBatch() const {return header->mini_batch;};
+				std::size_t getSamples() const {return header->samples;};
+				std::size_t getRecords() const {return header->records;};
+				int next(enum FEATURE_RECORD &type, float *frames, const std::size_t max_frames, std::size_t &nf);
+
+			private:
+				FeatureReader();
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_FEATURE_STORE_H__ */
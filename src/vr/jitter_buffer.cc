@@ -0,0 +1,170 @@
+/**
+ * @file	jitter_buffer.cc
+ * @brief	실시간 STT 지터 버퍼
+ * @details
+ * @date	2026. 10. 19. 07:18:26
+ * @see		jitter_buffer.hpp
+ */
+
+#include "jitter_buffer.hpp"
+
+using namespace itfact::vr::node;
+
+/// 늦은 패킷을 판별하기 위해 기억하는 묵음 순번 범위
+static const uint32_t FILLED_WINDOW = 4096;
+
+void JitterStats::stats(std::string &result) const {
+	result.append("realtime.jitter.received\t").append(std::to_string(received.load())).push_back('\n');
+	result.append("realtime.jitter.reordered\t").append(std::to_string(reordered.load())).push_back('\n');
+	result.append("realtime.jitter.late\t").append(std::to_string(late.load())).push_back('\n');
+	result.append("realtime.jitter.duplicate\t").append(std::to_string(duplicate.load())).push_back('\n');
+	result.append("realtime.jitter.dropped\t").append(std::to_string(dropped.load())).push_back('\n');
+}
+
+/**
+ * @param[in]	depth		빠진 패킷을 기다리는 동안 쌓아 둘 최대 패킷 수
+ * @param[in]	counters	통계
+ */
+JitterBuffer::JitterBuffer(const std::size_t depth, JitterStats *counters)
+: depth(depth), counters(counters), last_used(std::chrono::steady_clock::now()) {
+}
+
+void JitterBuffer::restart() {
+	packets.clear();
+	filled.clear();
+	started = closed = has_last = false;
+	next = skipped_begin = skipped_end = 0;
+	last_samples = 0;
+}
+
+/**
+ * @brief		패킷 추가
+ * @details		첫 순번은 FIRST 패킷의 순번이며, FIRST 패킷 없이 depth개를 넘게 받거나 LAST 패킷을 받으면
+ 			가장 작은 순번부터 시작한다.
+ * @date		2026. 10. 19. 07:26:03
+ * @param[in]	packet	v2 패킷
+ * @return		늦거나 중복된 패킷이면 false
+ */
+bool JitterBuffer::push(const rt_packet_t &packet) {
+	std::lock_guard<std::mutex> guard(lock);
+	const uint32_t sequence = packet.sequence;
+	last_used = std::chrono::steady_clock::now();
+	++counters->received;
+
+	if (packet.state == 0 && closed)
+		restart();	// 같은 Call ID의 새 통화
+	if (closed || (started && sequence < next)) {
+		if (closed || filled.count(sequence) || (sequence >= skipped_begin && sequence < skipped_end))
+			++counters->late;
+		else
+			++counters->duplicate;
+		return false;
+	}
+	if (packets.count(sequence)) {
+		++counters->duplicate;
+		return false;
+	}
+	if (!packets.empty() && sequence < packets.rbegin()->first)
+		++counters->reordered;
+
+	packet_t &item = packets[sequence];
+	item.pcm.assign(packet.pcm, packet.pcm + packet.samples);
+	item.state = packet.state;
+	item.arrival = packet.arrival;
+	if (packet.state == 2)
+		has_last = true;
+
+	if (!started) {
+		if (packet.state == 0) {
+			packets.erase(packets.begin(), packets.find(sequence));
+			started = true;
+		} else if (packets.size() > depth || has_last) {
+			started = true;
+		}
+		next = packets.begin()->first;
+	}
+	return true;
+}
+
+/**
+ * @brief		패킷 꺼내기 시작
+ * @param[in]	wait	다른 작업자가 꺼내는 중이면 끝날 때까지 기다림 (LAST 패킷)
+ * @return		다른 작업자가 꺼내는 중이면 false (wait가 false인 경우)
+ * @see			JitterBuffer::pop()
+ */
+bool JitterBuffer::begin(const bool wait) {
+	std::unique_lock<std::mutex> guard(lock);
+	if (draining && !wait)
+		return false;
+	cond.wait(guard, [this] {return !draining;});
+	draining = true;
+	return true;
+}
+
+/**
+ * @brief		순서대로 다음 패킷 꺼내기
+ * @details		꺼낼 패킷이 없으면 꺼내기를 끝낸다. 빠진 패킷은 직전 패킷 길이의 묵음으로 채우며,
+ 			depth개보다 많이 빠졌으면 묵음 없이 다음 패킷으로 건너뛴다.
+ * @date		2026. 10. 19. 07:33:48
+ * @param[in]	final_owner	LAST 패킷을 받은 작업자 (아니면 LAST 패킷 앞에서 멈춤)
+ * @param[out]	packet		디코더에 넣을 패킷
+ * @return		꺼낼 패킷이 없으면 false
+ */
+bool JitterBuffer::pop(const bool final_owner, packet_t &packet) {
+	std::lock_guard<std::mutex> guard(lock);
+	while (started && !closed && !packets.empty()) {
+		auto first = packets.begin();
+		if (first->first < next) {
+			packets.erase(first);
+			continue;
+		}
+
+		if (first->first == next) {
+			if (first->second.state == 2 && !final_owner)
+				break;
+
+			packet.pcm.swap(first->second.pcm);
+			packet.state = first->second.state;
+			packet.arrival = first->second.arrival;
+			packets.erase(first);
+			++next;
+			last_samples = packet.pcm.size();
+			if (packet.state == 2) {
+				closed = true;
+				has_last = false;
+			}
+			while (!filled.empty() && *filled.begin() + FILLED_WINDOW < next)
+				filled.erase(filled.begin());
+			return true;
+		}
+
+		if (packets.size() <= depth && !has_last)
+			break;
+
+		// 디코딩할 묵음의 양은 순번 차이가 아니라 depth로 제한
+		const uint32_t gap = first->first - next;
+		if (gap > depth) {
+			counters->dropped += gap;
+			skipped_begin = next;
+			skipped_end = next = first->first;
+			continue;
+		}
+
+		// 빠진 패킷을 묵음으로 채움
+		packet.pcm.assign(last_samples ? last_samples : first->second.pcm.size(), 0);
+		packet.state = 1;
+		packet.arrival = first->second.arrival;
+		filled.insert(next++);
+		++counters->dropped;
+		return true;
+	}
+
+	draining = false;
+	cond.notify_all();
+	return false;
+}
+
+std::chrono::steady_clock::time_point JitterBuffer::getLastUsed() {
+	std::lock_guard<std::mutex> guard(lock);
+	return last_used;
+}
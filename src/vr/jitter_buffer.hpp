@@ -0,0 +1,95 @@
+/**
+ * @headerfile	jitter_buffer.hpp "jitter_buffer.hpp"
+ * @file	jitter_buffer.hpp
+ * @brief	실시간 STT 지터 버퍼
+ * @details	한 통화의 패킷이 여러 vr_realtime 작업자에 순서 없이 도착할 수 있으므로
+ 			v2 패킷의 순번으로 다시 정렬하여 디코더에 순서대로 넣는다.\n
+ 			빠진 패킷은 뒤에 depth개 이상의 패킷이 기다리거나 LAST 패킷이 도착하면 묵음으로 채운다.
+ 			순번은 클라이언트가 정하므로 depth개보다 많이 빠진 구간은 묵음으로 채우지 않고 건너뛴다.
+ 			통화마다 한 작업자만 패킷을 꺼내 디코딩하며(drain), 다른 작업자는 패킷을 넣기만 하고 바로 응답한다.
+ 			LAST 패킷을 받은 작업자는 앞선 작업자를 기다렸다가 최종 결과를 가져간다.
+ * @date	2026. 10. 19. 07:18:26
+ * @see		rt_packet.hpp
+ */
+
+#ifndef __ITFACT_VR_JITTER_BUFFER_H__
+#define __ITFACT_VR_JITTER_BUFFER_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "rt_packet.hpp"
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/**
+			 * @brief	지터 버퍼 통계 (모든 통화)
+			 */
+			class JitterStats
+			{
+			public:
+				std::atomic<uint64_t> received;
+				std::atomic<uint64_t> reordered;	///< 순서가 바뀌어 도착한 패킷
+				std::atomic<uint64_t> late;			///< 묵음으로 채운 후 도착하여 버린 패킷
+				std::atomic<uint64_t> duplicate;	///< 이미 받은 순번의 패킷
+				std::atomic<uint64_t> dropped;		///< 도착하지 않아 묵음으로 채운 패킷
+
+				JitterStats() : received(0), reordered(0), late(0), duplicate(0), dropped(0) {};
+				void stats(std::string &result) const;
+			};
+
+			/**
+			 * @brief	통화별 지터 버퍼
+			 */
+			class JitterBuffer
+			{
+			public:
+				/// 디코더에 넣을 패킷
+				typedef struct {
+					std::vector<short> pcm;
+					char state;			///< 0: FIRST, 1: 중간, 2: LAST
+					std::chrono::steady_clock::time_point arrival;	///< 받은 시각
+				} packet_t;
+
+			private:
+				std::mutex lock;
+				std::condition_variable cond;
+				std::map<uint32_t, packet_t> packets;	///< 순번 순서로 기다리는 패킷
+				std::set<uint32_t> filled;		///< 묵음으로 채운 순번 (늦은 패킷 판별)
+				std::size_t depth;
+				JitterStats *counters;
+				bool started = false;			///< next가 정해짐
+				bool closed = false;			///< LAST 패킷까지 꺼냄
+				bool draining = false;			///< 패킷을 꺼내 디코딩하는 작업자가 있음
+				bool has_last = false;			///< LAST 패킷이 기다리는 중
+				uint32_t next = 0;				///< 다음에 꺼낼 순번
+				uint32_t skipped_begin = 0;		///< 마지막으로 건너뛴 순번 범위 [begin, end) (늦은 패킷 판별)
+				uint32_t skipped_end = 0;
+				std::size_t last_samples = 0;	///< 마지막으로 꺼낸 패킷의 샘플 수 (묵음 길이)
+				std::chrono::steady_clock::time_point last_used;
+
+			public:
+				JitterBuffer(const std::size_t depth, JitterStats *counters);
+
+				bool push(const rt_packet_t &packet);
+				bool begin(const bool wait);
+				bool pop(const bool final_owner, packet_t &packet);
+				std::chrono::steady_clock::time_point getLastUsed();
+
+			private:
+				JitterBuffer();
+				void restart();
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_JITTER_BUFFER_H__ */
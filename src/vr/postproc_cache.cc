@@ -0,0 +1,136 @@
+/**
+ * @file	postproc_cache.cc
+ * @brief	후처리(SPLPostProc) 결과 캐시
+ * @details
+ * @date	2026. 10. 18. 22:31:45
+ * @see		postproc_cache.hpp
+ */
+
+#include <functional>
+
+#include "postproc_cache.hpp"
+
+using namespace itfact::vr::node;
+
+/// 항목별 list/map 노드 크기 (대략)
+static const std::size_t ENTRY_OVERHEAD = 96;
+
+static inline std::size_t __entry_size(const std::string &key, const std::string &value) {
+	return key.size() + value.size() + ENTRY_OVERHEAD;
+}
+
+/**
+ * @brief		캐시 생성
+ * @date		2026. 10. 18. 22:36:10
+ * @param[in]	capacity	최대 크기 (bytes, shard별로 나눔)
+ * @param[in]	count		shard 수 (0이면 1)
+ * @param[in]	dictionary	사용자 사전 및 태깅 모델 fingerprint (통계 출력용)
+ */
+PostProcCache::PostProcCache(const std::size_t capacity, const std::size_t count, const std::string &dictionary)
+: dictionary(dictionary) {
+	const std::size_t n = count ? count : 1;
+	shard_capacity = capacity / n;
+	for (std::size_t i = 0; i < n; ++i) {
+		std::unique_ptr<shard_t> shard(new shard_t);
+		shard->size = 0;
+		shard->hits = shard->misses = shard->evictions = 0;
+		shards.push_back(std::move(shard));
+	}
+}
+
+PostProcCache::shard_t &PostProcCache::getShard(const std::string &key) {
+	return *shards[std::hash<std::string>()(key) % shards.size()];
+}
+
+/**
+ * @brief		후처리 결과 조회
+ * @param[in]	key		SPLPostProc 입력
+ * @param[out]	value	후처리 결과
+ * @return		캐시에 있으면 true
+ */
+bool PostProcCache::get(const std::string &key, std::string &value) {
+	shard_t &shard = getShard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+
+	auto search = shard.index.find(key);
+	if (search == shard.index.end()) {
+		++shard.misses;
+		return false;
+	}
+
+	shard.lru.splice(shard.lru.begin(), shard.lru, search->second);
+	value = search->second->second;
+	++shard.hits;
+	return true;
+}
+
+/**
+ * @brief		후처리 결과 저장
+ * @details		shard 크기를 넘으면 오래 사용하지 않은 결과부터 삭제한다.
+ * @param[in]	key		SPLPostProc 입력
+ * @param[in]	value	후처리 결과
+ */
+void PostProcCache::put(const std::string &key, const std::string &value) {
+	const std::size_t size = __entry_size(key, value);
+	if (size > shard_capacity)
+		return;
+
+	shard_t &shard = getShard(key);
+	std::lock_guard<std::mutex> guard(shard.lock);
+
+	auto search = shard.index.find(key);
+	if (search != shard.index.end()) {
+		shard.size -= __entry_size(key, search->second->second);
+		shard.lru.erase(search->second);
+		shard.index.erase(search);
+	}
+
+	shard.lru.push_front(entry_t(key, value));
+	shard.index[key] = shard.lru.begin();
+	shard.size += size;
+
+	while (shard.size > shard_capacity) {
+		const entry_t &last = shard.lru.back();
+		shard.size -= __entry_size(last.first, last.second);
+		shard.index.erase(last.first);
+		shard.lru.pop_back();
+		++shard.evictions;
+	}
+}
+
+/**
+ * @brief		모든 결과 삭제
+ * @details		사용자 사전이나 태깅 모델을 해제하거나 다시 로드할 때 호출한다.
+ */
+void PostProcCache::clear() {
+	for (auto &&shard : shards) {
+		std::lock_guard<std::mutex> guard(shard->lock);
+		shard->index.clear();
+		shard->lru.clear();
+		shard->size = 0;
+	}
+}
+
+void PostProcCache::stats(std::string &result) {
+	std::size_t entries = 0, size = 0;
+	uint64_t hits = 0, misses = 0, evictions = 0;
+	for (auto &&shard : shards) {
+		std::lock_guard<std::mutex> guard(shard->lock);
+		entries += shard->lru.size();
+		size += shard->size;
+		hits += shard->hits;
+		misses += shard->misses;
+		evictions += shard->evictions;
+	}
+
+	result.append("postproc_cache.dictionary\t").append(dictionary).push_back('\n');
+	result.append("postproc_cache.shards\t").append(std::to_string(shards.size())).push_back('\n');
+	result.append("postproc_cache.entries\t").append(std::to_string(entries)).push_back('\n');
+	result.append("postproc_cache.size\t").append(std::to_string(size)).push_back('\n');
+	result.append("postproc_cache.capacity\t").append(std::to_string(shard_capacity * shards.size())).push_back('\n');
+	result.append("postproc_cache.hits\t").append(std::to_string(hits)).push_back('\n');
+	result.append("postproc_cache.misses\t").append(std::to_string(misses)).push_back('\n');
+	result.append("postproc_cache.evictions\t").append(std::to_string(evictions)).push_back('\n');
+	result.append("postproc_cache.hit_rate\t")
+		.append(std::to_string(hits + misses ? static_cast<double>(hits) / (hits + misses) : 0.0)).push_back('\n');
+}
@@ -0,0 +1,63 @@
+/**
+ * @headerfile	postproc_cache.hpp "postproc_cache.hpp"
+ * @file	postproc_cache.hpp
+ * @brief	후처리(SPLPostProc) 결과 캐시
+ * @details	상담 스크립트처럼 반복되는 문장의 SPLPostProc 결과를 입력 텍스트를 키로 메모리에 보관한다.\n
+ 			잠금 경합을 줄이기 위해 키의 해시로 나눈 shard마다 LRU를 따로 유지한다.
+ 			결과는 사용자 사전과 태깅 모델에 따라 달라지므로 이들을 다시 로드하면 clear()해야 한다.
+ * @date	2026. 10. 18. 22:31:45
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_POSTPROC_CACHE_H__
+#define __ITFACT_VR_POSTPROC_CACHE_H__
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/**
+			 * @brief	Sharded LRU 후처리 결과 캐시
+			 */
+			class PostProcCache
+			{
+			private:
+				typedef std::pair<std::string, std::string> entry_t;	///< 입력, 후처리 결과
+				typedef struct {
+					std::mutex lock;
+					std::list<entry_t> lru;			///< 최근 사용 순서 (앞쪽이 최근)
+					std::unordered_map<std::string, std::list<entry_t>::iterator> index;
+					std::size_t size;
+					uint64_t hits;
+					uint64_t misses;
+					uint64_t evictions;
+				} shard_t;
+
+				std::vector<std::unique_ptr<shard_t>> shards;
+				std::size_t shard_capacity;
+				std::string dictionary;		///< 사용자 사전 및 태깅 모델 fingerprint
+
+			public:
+				PostProcCache(const std::size_t capacity, const std::size_t count, const std::string &dictionary);
+
+				bool get(const std::string &key, std::string &value);
+				void put(const std::string &key, const std::string &value);
+				void clear();
+				void stats(std::string &result);
+
+			private:
+				PostProcCache();
+				shard_t &getShard(const std::string &key);
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_POSTPROC_CACHE_H__ */
@@ -0,0 +1,271 @@
+/**
+ * @file	result_cache.cc
+ * @brief	STT 결과 캐시
+ * @details
+ * @date	2026. 10. 18. 15:52:31
+ * @see		result_cache.hpp
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "result_cache.hpp"
+
+#define THREAD_ID	std::this_thread::get_id()
+#define LOG_INFO	__FILE__, __FUNCTION__, __LINE__
+#define LOG_FMT		" [at %s (%s:%d)]"
+
+using namespace itfact::vr::node;
+
+static const char CACHE_EXT[] = ".cell";
+
+/**
+ * @brief		캐시 디렉터리의 기존 결과를 최근 수정 순서로 로드
+ * @date		2026. 10. 18. 15:55:02
+ * @param[in]	path		캐시 디렉터리
+ * @param[in]	capacity	최대 크기 (bytes)
+ */
+ResultCache::ResultCache(const std::string &path, const std::size_t capacity, log4cpp::Category *logger)
+: logger(logger), path(path), capacity(capacity) {
+	namespace fs = boost::filesystem;
+
+	if (this->path.empty() || this->path.at(this->path.size() - 1) != '/')
+		this->path.push_back('/');
+
+	std::vector<std::tuple<std::time_t, std::string, std::size_t>> entries;
+	try {
+		for (fs::directory_iterator iter(this->path); iter != fs::directory_iterator(); ++iter) {
+			if (!fs::is_regular_file(iter->status()))
+				continue;
+
+			if (iter->path().extension().string().compare(CACHE_EXT) != 0) {
+				// 저장 중 종료된 임시 파일
+				if (iter->path().extension().string().compare(".tmp") == 0)
+					fs::remove(iter->path());
+				continue;
+			}
+
+			entries.push_back(std::make_tuple(fs::last_write_time(iter->path()),
+											  iter->path().stem().string(),
+											  static_cast<std::size_t>(fs::file_size(iter->path()))));
+		}
+	} catch (std::exception &e) {
+		logger->error("Cannot read cache directory %s: %s", this->path.c_str(), e.what());
+	}
+
+	std::sort(entries.begin(), entries.end(),
+		[](const std::tuple<std::time_t, std::string, std::size_t> &a,
+		   const std::tuple<std::time_t, std::string, std::size_t> &b) {
+			return std::get<0>(a) > std::get<0>(b);
+		});
+
+	for (auto &&entry : entries) {
+		lru.push_back(entry_t(std::get<1>(entry), std::get<2>(entry)));
+		index[std::get<1>(entry)] = std::prev(lru.end());
+		total_size += std::get<2>(entry);
+	}
+
+	// 설정된 크기가 줄어든 경우
+	while (total_size > this->capacity && !lru.empty()) {
+		std::remove(getPathname(lru.back().first).c_str());
+		total_size -= lru.back().second;
+		index.erase(lru.back().first);
+		lru.pop_back();
+	}
+
+	logger->info("Result cache: %s (%lu entries, %lu/%lu bytes)",
+				 this->path.c_str(), lru.size(), total_size, this->capacity);
+}
+
+std::string ResultCache::getPathname(const std::string &key) const {
+	return path + key + CACHE_EXT;
+}
+
+/**
+ * @brief		캐시된 결과를 가져오거나 fn으로 생성
+ * @details		같은 키를 처리 중인 요청이 있으면 그 결과를 기다린다.
+ 			먼저 처리한 요청이 실패하면 기다린 요청은 각자 fn을 수행한다.
+ * @date		2026. 10. 18. 16:03:44
+ * @param[in]	key		캐시 키
+ * @param[out]	value	결과
+ * @param[in]	fn		캐시에 없는 경우 결과를 생성할 함수
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, fn의 반환값이 반환된다.
+ */
+int ResultCache::get(const std::string &key, std::string &value, const std::function<int (std::string &)> &fn) {
+	std::shared_ptr<flight_t> flight;
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		auto search = flights.find(key);
+		if (search != flights.end()) {
+			flight = search->second;
+			++coalesced;
+			cond.wait(guard, [&flight]() {return flight->done;});
+			if (flight->rc == EXIT_SUCCESS) {
+				value.append(flight->value);
+				return EXIT_SUCCESS;
+			}
+			flight.reset();
+		} else {
+			flight = std::make_shared<flight_t>();
+			flight->done = false;
+			flight->rc = EXIT_FAILURE;
+			flights[key] = flight;
+		}
+	}
+
+	// 앞선 요청이 실패한 경우
+	if (!flight)
+		return fn(value);
+
+	std::string result;
+	int rc = EXIT_FAILURE;
+	try {
+		if (load(key, result)) {
+			rc = EXIT_SUCCESS;
+		} else {
+			rc = fn(result);
+			if (rc == EXIT_SUCCESS)
+				store(key, result);
+		}
+	} catch (...) {
+		std::lock_guard<std::mutex> guard(lock);
+		flight->done = true;
+		flights.erase(key);
+		cond.notify_all();
+		throw;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		flight->done = true;
+		flight->rc = rc;
+		if (flight.use_count() > 2 && rc == EXIT_SUCCESS)
+			flight->value = result;
+		flights.erase(key);
+	}
+	cond.notify_all();
+
+	value.append(result);
+	return rc;
+}
+
+/**
+ * @brief		디스크에서 결과를 읽음
+ * @retval		true	캐시 적중
+ * @retval		false	캐시 없음
+ */
+bool ResultCache::load(const std::string &key, std::string &value) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto search = index.find(key);
+		if (search == index.end()) {
+			++misses;
+			return false;
+		}
+		lru.splice(lru.begin(), lru, search->second);
+	}
+
+	std::FILE *fp = std::fopen(getPathname(key).c_str(), "rb");
+	if (fp) {
+		std::shared_ptr<std::FILE> fd(fp, std::fclose);
+		char buffer[8192];
+		std::size_t rsize;
+		while ((rsize = std::fread(buffer, 1, sizeof(buffer), fd.get())) > 0)
+			value.append(buffer, rsize);
+
+		if (!std::ferror(fd.get())) {
+			std::lock_guard<std::mutex> guard(lock);
+			++hits;
+			return true;
+		}
+	}
+
+	logger->warn("[0x%X] Cannot read cached result: %s" LOG_FMT, THREAD_ID, key.c_str(), LOG_INFO);
+	value.clear();
+	remove(key);
+	std::lock_guard<std::mutex> guard(lock);
+	++misses;
+	return false;
+}
+
+/**
+ * @brief		결과를 디스크에 저장
+ * @details		임시 파일에 기록한 후 rename()하며, 최대 크기를 넘으면 오래 사용하지 않은 결과부터 삭제한다.
+ */
+void ResultCache::store(const std::string &key, const std::string &value) {
+	if (value.size() > capacity)
+		return;
+
+	std::string pathname = getPathname(key);
+	std::string tmp_pathname(pathname);
+	tmp_pathname.append(".tmp");
+
+	std::FILE *fp = std::fopen(tmp_pathname.c_str(), "wb");
+	if (!fp) {
+		logger->warn("[0x%X] Cannot write %s" LOG_FMT, THREAD_ID, tmp_pathname.c_str(), LOG_INFO);
+		return;
+	}
+	bool success = std::fwrite(value.data(), 1, value.size(), fp) == value.size();
+	success = (std::fclose(fp) == 0) && success;
+	if (!success || std::rename(tmp_pathname.c_str(), pathname.c_str()) != 0) {
+		std::remove(tmp_pathname.c_str());
+		return;
+	}
+
+	std::vector<std::string> evicted;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto search = index.find(key);
+		if (search != index.end()) {
+			total_size -= search->second->second;
+			lru.erase(search->second);
+		}
+		lru.push_front(entry_t(key, value.size()));
+		index[key] = lru.begin();
+		total_size += value.size();
+
+		while (total_size > capacity && lru.size() > 1) {
+			evicted.push_back(lru.back().first);
+			total_size -= lru.back().second;
+			index.erase(lru.back().first);
+			lru.pop_back();
+		}
+	}
+
+	for (auto &&item : evicted)
+		std::remove(getPathname(item).c_str());
+}
+
+void ResultCache::remove(const std::string &key) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		auto search = index.find(key);
+		if (search == index.end())
+			return;
+		total_size -= search->second->second;
+		lru.erase(search->second);
+		index.erase(search);
+	}
+	std::remove(getPathname(key).c_str());
+}
+
+/**
+ * @brief		캐시 상태
+ * @param[out]	result	"항목\t값" 형식의 줄
+ */
+void ResultCache::stats(std::string &result) {
+	std::lock_guard<std::mutex> guard(lock);
+	result.append("cache.entries\t").append(std::to_string(lru.size())).push_back('\n');
+	result.append("cache.size\t").append(std::to_string(total_size)).push_back('\n');
+	result.append("cache.capacity\t").append(std::to_string(capacity)).push_back('\n');
+	result.append("cache.hits\t").append(std::to_string(hits)).push_back('\n');
+	result.append("cache.misses\t").append(std::to_string(misses)).push_back('\n');
+	result.append("cache.coalesced\t").append(std::to_string(coalesced)).push_back('\n');
+}
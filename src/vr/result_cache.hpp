@@ -0,0 +1,76 @@
+/**
+ * @headerfile	result_cache.hpp "result_cache.hpp"
+ * @file	result_cache.hpp
+ * @brief	STT 결과 캐시
+ * @details	녹취 데이터의 해시를 키로 STT 결과(cell data)를 로컬 디스크에 저장한다.\n
+ 			같은 키의 요청이 동시에 들어오면 하나만 처리하고 나머지는 그 결과를 받는다.
+ * @date	2026. 10. 18. 15:40:18
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_RESULT_CACHE_H__
+#define __ITFACT_VR_RESULT_CACHE_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <log4cpp/Category.hh>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/**
+			 * @brief	디스크 기반 STT 결과 캐시 (LRU)
+			 */
+			class ResultCache
+			{
+			private:
+				typedef struct {
+					bool done;
+					int rc;
+					std::string value;
+				} flight_t;
+				typedef std::pair<std::string, std::size_t> entry_t;	///< 키, 파일 크기
+
+				log4cpp::Category *logger;
+				std::string path;
+				std::size_t capacity;
+				std::size_t total_size = 0;
+
+				std::mutex lock;
+				std::condition_variable cond;
+				std::list<entry_t> lru;			///< 최근 사용 순서 (앞쪽이 최근)
+				std::unordered_map<std::string, std::list<entry_t>::iterator> index;
+				std::map<std::string, std::shared_ptr<flight_t>> flights;	///< 처리 중인 키
+
+				uint64_t hits = 0;
+				uint64_t misses = 0;
+				uint64_t coalesced = 0;
+
+			public:
+				ResultCache(const std::string &path, const std::size_t capacity,
+							log4cpp::Category *logger = &log4cpp::Category::getRoot());
+
+				int get(const std::string &key, std::string &value,
+						const std::function<int (std::string &)> &fn);
+				void stats(std::string &result);
+
+			private:
+				ResultCache();
+				std::string getPathname(const std::string &key) const;
+				bool load(const std::string &key, std::string &value);
+				void store(const std::string &key, const std::string &value);
+				void remove(const std::string &key);
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_RESULT_CACHE_H__ */
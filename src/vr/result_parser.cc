@@ -0,0 +1,145 @@
+/**
+ * @file	result_parser.cc
+ * @brief	Laser 인식 결과 파서
+ * @details
+ * @date	2026. 10. 18. 19:10:22
+ * @see		result_parser.hpp
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "result_parser.hpp"
+
+using namespace itfact::vr::node;
+
+static inline bool isBlank(const char c) {
+	return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static inline const char *skipBlank(const char *p) {
+	while (isBlank(*p))
+		++p;
+	return p;
+}
+
+static inline const char *nextLine(const char *p) {
+	while (*p != '\0' && *p != '\n')
+		++p;
+	return *p == '\n' ? p + 1 : p;
+}
+
+/// sscanf("%d")와 같이 부호가 있는 정수를 읽음
+static inline const char *parseLong(const char *p, long &value) {
+	p = skipBlank(p);
+	bool negative = false;
+	if (*p == '-' || *p == '+')
+		negative = (*p++ == '-');
+	if (*p < '0' || *p > '9')
+		return NULL;
+
+	long v = 0;
+	for (; *p >= '0' && *p <= '9'; ++p)
+		v = v * 10 + (*p - '0');
+	value = negative ? -v : v;
+	return p;
+}
+
+/**
+ * @brief		인식 결과 파싱
+ * @details		한 줄은 "start end word likelihood"이며, 네 항목을 모두 읽을 수 없는 줄은 무시한다.
+ * @date		2026. 10. 18. 19:16:48
+ * @param[in]	result	getWBAdjustedResultSLaser() 결과
+ * @param[out]	words	단어 목록 (기존 내용은 지워지며 할당된 공간은 재사용)
+ * @return		단어 수
+ */
+std::size_t itfact::vr::node::parseResult(const char *result, std::vector<result_word_t> &words) {
+	words.clear();
+	if (result == NULL)
+		return 0;
+
+	result_word_t word;
+	for (const char *p = result; *p != '\0'; p = nextLine(p)) {
+		const char *q = parseLong(p, word.start);
+		if (q == NULL || (q = parseLong(q, word.end)) == NULL)
+			continue;
+
+		q = skipBlank(q);
+		word.word = q;
+		while (*q != '\0' && *q != '\n' && !isBlank(*q))
+			++q;
+		word.length = static_cast<std::size_t>(q - word.word);
+		if (word.length == 0)
+			continue;
+
+		q = skipBlank(q);
+		if (*q == '\0' || *q == '\n')
+			continue;
+		char *end = NULL;
+		word.like = std::strtof(q, &end);
+		if (end == q)
+			continue;
+
+		words.push_back(word);
+	}
+
+	return words.size();
+}
+
+/**
+ * @brief		10진수 정수를 buffer 뒤에 추가
+ */
+void itfact::vr::node::appendNumber(std::string &buffer, unsigned long value) {
+	char digits[24];
+	char *p = digits + sizeof(digits);
+	do {
+		*--p = static_cast<char>('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+	buffer.append(p, digits + sizeof(digits) - p);
+}
+
+void itfact::vr::node::appendNumber(std::string &buffer, long value) {
+	if (value < 0) {
+		buffer.push_back('-');
+		appendNumber(buffer, static_cast<unsigned long>(-(value + 1)) + 1);
+	} else {
+		appendNumber(buffer, static_cast<unsigned long>(value));
+	}
+}
+
+/**
+ * @brief		실수를 buffer 뒤에 추가 (boost::lexical_cast<std::string>(float)와 같은 형식)
+ */
+void itfact::vr::node::appendNumber(std::string &buffer, float value) {
+	char digits[32];
+	int length = std::snprintf(digits, sizeof(digits), "%.9g", static_cast<double>(value));
+	if (length > 0)
+		buffer.append(digits, static_cast<std::size_t>(length));
+}
+
+/**
+ * @brief		실수를 buffer 뒤에 추가 (boost::lexical_cast<std::string>(double)와 같은 형식)
+ */
+void itfact::vr::node::appendNumber(std::string &buffer, double value) {
+	char digits[40];
+	int length = std::snprintf(digits, sizeof(digits), "%.17g", value);
+	if (length > 0)
+		buffer.append(digits, static_cast<std::size_t>(length));
+}
+
+/**
+ * @brief		"start\tend\tword\tlikelihood\n" 형식의 한 줄을 buffer 뒤에 추가
+ * @date		2026. 10. 18. 19:24:05
+ */
+void itfact::vr::node::appendWord(std::string &buffer, const unsigned long start, const unsigned long end,
+								  const char *word, const std::size_t length, const float like) {
+	appendNumber(buffer, start);
+	buffer.push_back('\t');
+	appendNumber(buffer, end);
+	buffer.push_back('\t');
+	buffer.append(word, length);
+	buffer.push_back('\t');
+	appendNumber(buffer, like);
+	buffer.push_back('\n');
+}
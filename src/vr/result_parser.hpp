@@ -0,0 +1,44 @@
+/**
+ * @headerfile	result_parser.hpp "result_parser.hpp"
+ * @file	result_parser.hpp
+ * @brief	Laser 인식 결과 파서
+ * @details	getWBAdjustedResultSLaser()가 반환하는 "start end word likelihood" 줄 단위 결과를
+ 			한 번에 읽어 단어 정보를 재사용하는 vector에 저장한다. 단어는 엔진 버퍼를 가리키므로
+ 			엔진 버퍼가 바뀌기 전에 사용해야 한다.\n
+ 			결과 출력은 boost::lexical_cast와 같은 형식(정수, float는 %.9g, double은 %.17g)으로 한다.
+ * @date	2026. 10. 18. 19:10:22
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_RESULT_PARSER_H__
+#define __ITFACT_VR_RESULT_PARSER_H__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/// 인식 결과 단어
+			typedef struct {
+				long start;				///< 시작 프레임
+				long end;				///< 종료 프레임
+				const char *word;		///< 단어 (NULL 종료 문자열이 아님)
+				std::size_t length;		///< 단어 길이
+				float like;				///< likelihood
+			} result_word_t;
+
+			std::size_t parseResult(const char *result, std::vector<result_word_t> &words);
+
+			void appendNumber(std::string &buffer, unsigned long value);
+			void appendNumber(std::string &buffer, long value);
+			void appendNumber(std::string &buffer, float value);
+			void appendNumber(std::string &buffer, double value);
+			void appendWord(std::string &buffer, const unsigned long start, const unsigned long end,
+							const char *word, const std::size_t length, const float like);
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_RESULT_PARSER_H__ */
@@ -6,6 +6,8 @@
  * @see		vr.cc
  */
  
+#include <algorithm>
+#include <cfloat>
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
@@ -63,6 +65,9 @@ RealtimeSTT::RealtimeSTT(
 	temp_buffer = (float *) malloc(sizeof(float) * minimum_size);//(short *) malloc(sizeof(short) * minimum_size);
 	if (temp_buffer == NULL)
 		throw std::system_error(ENOMEM, std::system_category());
+
+	// mini batch 미만의 남은 프레임 + FrontEnd 한 번의 출력 (첫 구간은 LDA 프레임 스택 포함)
+	pending.resize((2 * mini_batch + 2 * LDA_LEN_FRAMESTACK) * mfcc_size);
 }
 
 /**
@@ -88,8 +93,56 @@ void RealtimeSTT::set_reset_period(const std::size_t period) {
 	reset_period = period;
 }
 
+/**
+ * @brief		발화 끝 검출 사용
+ * @details		발화가 끝나면 LAST 패킷을 기다리지 않고 그 패킷에서 발화의 최종 결과를 출력한다.
+ * @date		2026. 10. 19. 06:12:44
+ * @param[in]	trailing	발화를 끝내는 묵음 프레임 수 (10ms)
+ * @param[in]	min_speech	발화로 인정하는 최소 음성 프레임 수 (10ms)
+ * @param[in]	latency		발화 끝에서 최종 결과까지의 지연 시간 (NULL: 기록하지 않음)
+ */
+void RealtimeSTT::set_endpoint(const std::size_t trailing, const std::size_t min_speech,
+							   const std::shared_ptr<LatencyHistogram> &latency) {
+	endpointer.reset(new Endpointer(trailing, min_speech));
+	endpoint_latency = latency;
+}
+
+/**
+ * @brief		늦은 패킷에서 사용할 beam 설정
+ * @date		2026. 10. 19. 09:52:03
+ * @param[in]	normal		기본 GENBEAM
+ * @param[in]	narrow		RT_DEGRADE_BEAM의 GENBEAM (빈 문자열: beam을 바꾸지 않음)
+ */
+void RealtimeSTT::set_degrade_beam(const std::string &normal, const std::string &narrow) {
+	beam = normal;
+	narrow_beam = narrow;
+}
+
+/**
+ * @brief		다음 패킷의 디코딩 방법
+ * @details		RT_DEGRADE_PARTIAL 이상이면 중간 결과를 생략하며 생략한 단어는 다음 패킷이나 최종 결과에서 출력한다.
+ 			RT_DEGRADE_BEAM이면 beam을 좁히고, 그보다 낮은 단계가 되면 되돌린다.
+ * @date		2026. 10. 19. 09:55:40
+ * @param[in]	level		RT_DEGRADE
+ * @see			RealtimeScheduler::acquire()
+ */
+void RealtimeSTT::set_degrade(const int level) {
+	degrade = level;
+	const bool narrow = level >= RT_DEGRADE_BEAM && !narrow_beam.empty();
+	if (narrow == narrowed)
+		return;
+
+	setSLaserConfig(laser.get(), const_cast<char *>("GENBEAM"),
+					const_cast<char *>(narrow ? narrow_beam.c_str() : beam.c_str()));
+	narrowed = narrow;
+}
+
 /**
  * @brief		Speech to text
+ * @details		통화의 FrontEnd와 디코더 상태를 패킷 사이에 유지하며 특징 벡터는 mini batch 단위로 디코딩한다.
+ 			결과는 디코딩 위치에서 stable_frames 이상 지난 단어 중 앞선 패킷에서 출력하지 않은 단어이며,
+ 			마지막 패킷 후 free_buffer()로 나머지 단어를 가져온다.
+ 			발화 끝 검출을 사용하면 발화가 끝난 패킷에서 그 발화의 나머지 단어도 출력한다.
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2017. 03. 06. 16:41:03
@@ -99,124 +152,81 @@ void RealtimeSTT::set_reset_period(const std::size_t period) {
  * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
  				Otherwise,
  				a negative error code is returned indicating what went wrong.
- * @see			RealtimeSTT::unsegment()
+ * @see			RealtimeSTT::free_buffer()
  */
 int RealtimeSTT::stt(
 	const short *buffer,
 	const std::size_t buffer_len,
 	std::string &result
 ) {
-#if 0
-	std::size_t i;
-	int rc;
-	int reset_flag=0;
-
-	// FIXME: 데이터 푸시
-	// CASE 1) temp_buffer_len == 0 && (buffer_len + temp_buffer_len) >= minimum_size
-	// 분석 시도하고 남은 버퍼를 임시 버퍼에 보관 
-
-	// CASE 2) temp_buffer_len > 0 && (buffer_len + temp_buffer_len) >= minimum_size
-	// 버퍼와 합친 후 분석 시도하고 남은 버퍼를 임시 버퍼에 보관 
-
-	// CASE 3) (temp_buffer_len > 0 || temp_buffer_len == 0) && (buffer_len + temp_buffer_len) < minimum_size
-	// 임시 버퍼에 보관 
-
-	std::size_t remain_size = buffer_len;
-	std::size_t buffer_index = 0;
-	// std::size_t offset = 0;
-	while (remain_size > 0) {
-		if ((remain_size + temp_buffer_len) < minimum_size) {
-			memcpy(temp_buffer + temp_buffer_len, buffer + buffer_index, sizeof(short) * remain_size);
-			temp_buffer_len += remain_size;
-			break;
-			return EXIT_SUCCESS;
-		}
-
-		short *data;
-		std::size_t data_size = 0;
-		if (temp_buffer_len > 0) {
-			std::size_t copy_size = minimum_size - temp_buffer_len;
-			memcpy(temp_buffer + temp_buffer_len, buffer + buffer_index, sizeof(short) * copy_size);
-			data = temp_buffer;
-			buffer_index += copy_size;
-			remain_size -= copy_size;
-		} else {
-			data = const_cast<short *>(buffer + buffer_index);
-			buffer_index += minimum_size;
-			remain_size -= minimum_size;
-		}
-
-		data_size = minimum_size;
-		if (remain_size < 0)
-			data_size += remain_size;
-		temp_buffer_len = 0;
-
+	if (!incremental)
+		return stt_packet(buffer, buffer_len, result);
+
+	const auto started = std::chrono::steady_clock::now();
+	const std::size_t read_size = 80 * mini_batch;
+	const std::size_t decoded = index + last_position;
+	std::vector<std::size_t> finished;
+	for (std::size_t offset = 0; offset < buffer_len; offset += read_size) {
 		int fsize = 0;
-		if (likely(running++)) {
-			//result.clear();
-			rc = stepFrameLFrontEnd(front.get(), data_size, data, &fsize, feature_vector.get());
-			// if (rc)
-				job_log->debug("[0x%X] stepFrameLFrontEnd(0x%x), fsize: %d" LOG_FMT, THREAD_ID, rc, fsize, LOG_INFO);
-		} else {
-			float *_temp_vector = (float *) malloc(sizeof(float) * mfcc_size * mini_batch);
-			if (_temp_vector == NULL)
-				continue;
-			std::shared_ptr<float> temp_vector(_temp_vector, free);
-
-			rc = stepFrameLFrontEnd(front.get(), data_size, data, &fsize, temp_vector.get());
-			job_log->debug("[0x%X] stepFrameLFrontEnd(0x%x), fsize: %d" LOG_FMT, THREAD_ID, rc, fsize, LOG_INFO);
-
-			for (i = 0; i < VRServer::LDA_LEN_FRAMESTACK; ++i)
-				memcpy(feature_vector.get() + i * mfcc_size, temp_vector.get(), sizeof(float) * mfcc_size);
-			memcpy(feature_vector.get() + i * mfcc_size, temp_vector.get(), sizeof(float) * fsize);
-			fsize = fsize + i * mfcc_size;
+		std::size_t rsize = std::min(read_size, buffer_len - offset);
+
+		stepFrameLFrontEnd(front.get(), rsize, const_cast<short *>(&buffer[offset]), &fsize, feature_vector.get());
+		if (fsize > 0) {
+			if (!running++) {
+				// 통화의 첫 프레임을 LDA 프레임 스택 길이만큼 복제
+				for (std::size_t i = 0; i < LDA_LEN_FRAMESTACK; ++i, ++pending_frames)
+					memcpy(&pending[pending_frames * mfcc_size], feature_vector.get(), sizeof(float) * mfcc_size);
+			}
+			memcpy(&pending[pending_frames * mfcc_size], feature_vector.get(), sizeof(float) * fsize);
+			pending_frames += fsize / mfcc_size;
 		}
 
-		if (fsize <= 0)
-			continue;
-
-		std::size_t nf = fsize / mfcc_size;
-		if (nf < mini_batch)
-			memcpy(feature_vector.get() + nf * mfcc_size, sil, sizeof(float) * mfcc_size * (mini_batch - nf));
-
-		for (i = 0; i < nf; ++i) {
-			// 특징 벡터의 차원 값을 추가적으로 사용하여 프레임 기반의 탐색을 수행 (feature_dim = 128 * 600)
-			if (stepSARecFrameExt(laser.get(), index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
-				return EXIT_FAILURE;
+		if (endpointer) {
+			endpointer->append(&buffer[offset], rsize, endpoints);
+			for (auto &&end : endpoints) {
+				if (endpoint(end, result) != EXIT_SUCCESS)
+					return EXIT_FAILURE;
+				finished.push_back(end);
+			}
 		}
 
-		index += nf;
-		rc = get_intermediate_results(laser.get(), index, skip_position, last_position, reset_period, result);
-		if (rc == EXIT_SUCCESS && index > reset_period) {
-			// reallocSLaser(laser.get());
-			if (resetSLaser(laser.get())) {
-				job_log->error("[0x%X] Fail to resetSLaser" LOG_FMT, THREAD_ID, LOG_INFO);
+		while (pending_frames >= mini_batch) {
+			if (step(mini_batch, result) != EXIT_SUCCESS)
 				return EXIT_FAILURE;
-			}
-
-			index = 0;
-			last_position += skip_position;
-			skip_position = 0;
-
-			// after resetSLaser(), copy buffer to temp_buffer
-			reset_flag = 1;
 		}
 	}
 
-	// after resetSLaser(), copy buffer to temp_buffer
-	if (reset_flag) {
-		if ((buffer_len - minimum_size)>0) {
-			memcpy(temp_buffer, buffer+(buffer_len - minimum_size), sizeof(short) * minimum_size);
-			temp_buffer_len = minimum_size;
-		}
-		else {
-			memset(temp_buffer, 0, (sizeof(short) * minimum_size));
-			memcpy(temp_buffer, buffer, sizeof(short) * buffer_len);
-			temp_buffer_len = buffer_len;
-		}
-		reset_flag = 0;
+	// 발화 끝 지연: 발화가 끝난 후 받은 음성 길이 + 처리 시간
+	if (endpoint_latency && !finished.empty()) {
+		const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+		for (auto &&end : finished)
+			endpoint_latency->add((endpointer->getFrames() - end) * 10.0 + elapsed);
+	}
+
+	// 새로 디코딩한 구간이 있으면 확정된 단어 출력 (마지막 단어들은 다음 패킷에서 바뀔 수 있음)
+	if (index + last_position > decoded && index > stable_frames && degrade < RT_DEGRADE_PARTIAL) {
+		if (getIntermediateResults(laser.get(), index, skip_position, last_position, result,
+								   -FLT_MAX, last_position + index - stable_frames) != EXIT_SUCCESS)
+			job_log->warn("[0x%X] Fail to get intermediate results(%s)" LOG_FMT,
+						  THREAD_ID, m_callid.c_str(), LOG_INFO);
 	}
-#else
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		패킷 단위 STT
+ * @details		패킷마다 디코더와 FrontEnd를 초기화하여 패킷만 디코딩한다. (realtime.incremental = false)
+ * @author		Youngsoo Min (ysmin@itfact.co.kr)
+ * @author		Kijeong Khil (kjkhil@itfact.co.kr)
+ * @date		2017. 03. 06. 16:41:03
+ * @see			RealtimeSTT::stt()
+ */
+int RealtimeSTT::stt_packet(
+	const short *buffer,
+	const std::size_t buffer_len,
+	std::string &result
+) {
 	resetSLaser(laser.get()); 
 	resetLFrontEnd(front.get());	
 	// resetSLaser(laser/*.get()*/); 
@@ -318,12 +328,113 @@ int RealtimeSTT::stt(
 			return EXIT_FAILURE;
 	}
 
-#endif
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		대기 중인 특징 벡터를 디코딩
+ * @details		nf가 mini batch보다 작으면 나머지를 묵음으로 채운다.
+ 			디코딩한 프레임이 reset_period를 넘으면 최종 결과를 출력하고 디코더를 초기화한다.
+ * @date		2026. 10. 19. 03:48:20
+ * @param[in]	nf		디코딩할 프레임 수 (mini batch 이하)
+ * @param[out]	result	STT 결과 (뒤에 추가)
+ */
+int RealtimeSTT::step(const std::size_t nf, std::string &result) {
+	static thread_local std::vector<float> rest;
+	float *frames = pending.data();
+
+	rest.clear();
+	if (nf < mini_batch) {
+		// 묵음으로 채울 자리의 특징 벡터는 다음 발화에서 사용
+		if (pending_frames > nf)
+			rest.assign(frames + nf * mfcc_size, frames + pending_frames * mfcc_size);
+		memcpy(frames + nf * mfcc_size, sil, sizeof(float) * mfcc_size * (mini_batch - nf));
+	}
+
+	for (std::size_t i = 0; i < nf; ++i) {
+		// 특징 벡터의 차원 값을 추가적으로 사용하여 프레임 기반의 탐색을 수행 (feature_dim = 128 * 600)
+		if (stepSARecFrameExt(laser.get(), index + i, feature_dim, frames + i * mfcc_size) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+	}
+	index += nf;
+	pending_frames -= nf;
+	if (!rest.empty())
+		memcpy(frames, rest.data(), sizeof(float) * rest.size());
+	else if (pending_frames > 0)
+		memmove(frames, frames + nf * mfcc_size, sizeof(float) * mfcc_size * pending_frames);
+
+	if (index > reset_period)
+		return finalize(result);
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		발화 끝까지 디코딩하여 최종 결과 출력
+ * @details		발화 끝 뒤의 묵음(trailing)까지 디코딩하며, 그 뒤의 특징 벡터는 다음 발화로 남긴다.
+ * @date		2026. 10. 19. 06:20:18
+ * @param[in]	end		발화의 끝 프레임 (통화 시작 기준)
+ * @param[out]	result	STT 결과 (뒤에 추가)
+ */
+int RealtimeSTT::endpoint(const std::size_t end, std::string &result) {
+	// 특징 벡터는 통화 시작에 복제한 LDA 프레임 스택만큼 뒤에 있음
+	const std::size_t cut = end + endpointer->getTrailing() + LDA_LEN_FRAMESTACK;
+	const std::size_t decoded = last_position + index;
+	std::size_t remain = cut > decoded ? std::min(cut - decoded, pending_frames) : 0;
+	while (remain > 0) {
+		const std::size_t nf = std::min(remain, mini_batch);
+		if (step(nf, result) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+		remain -= nf;
+	}
+
+	return index ? finalize(result) : EXIT_SUCCESS;
+}
+
+/**
+ * @brief		최종 결과를 출력하고 디코더를 초기화
+ * @details		이후 디코딩 위치는 last_position부터 이어진다.
+ * @date		2026. 10. 19. 06:22:51
+ */
+int RealtimeSTT::finalize(std::string &result) {
+	if (final_result(result) != EXIT_SUCCESS)
+		job_log->warn("[0x%X] Fail to get final result(%s)" LOG_FMT, THREAD_ID, m_callid.c_str(), LOG_INFO);
+
+	if (resetSLaser(laser.get())) {
+		job_log->error("[0x%X] Fail to resetSLaser" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	last_position += index;
+	index = 0;
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		최종 결과 중 중간 결과로 출력하지 않은 단어를 출력
+ * @date		2026. 10. 19. 03:52:07
+ */
+int RealtimeSTT::final_result(std::string &result) {
+	static thread_local std::string words;
+	std::size_t position = last_position;
+
+	words.clear();
+	if (getFinalResult(laser.get(), index, position, feature_dim, mfcc_size, sil, words) != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	for (std::size_t offset = 0; offset < words.size(); ) {
+		std::size_t eol = words.find('\n', offset);
+		eol = (eol == std::string::npos) ? words.size() : eol + 1;
+		if (skip_position == 0 || std::strtoul(words.c_str() + offset, NULL, 10) > skip_position)
+			result.append(words, offset, eol - offset);
+		offset = eol;
+	}
 	return EXIT_SUCCESS;
 }
 
 /**
  * @brief		버퍼에 남은 녹취 데이터를 분석 시도
+ * @details		마지막 패킷 후 FrontEnd 내부 버퍼와 대기 중인 특징 벡터를 디코딩하여 최종 결과를 가져오고
+ 			다음 통화를 위해 상태를 초기화한다. 패킷 단위 STT에서는 패킷마다 최종 결과를 반환하므로 하는 일이 없다.
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2017. 03. 14. 10:58:54
  * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
@@ -331,19 +442,93 @@ int RealtimeSTT::stt(
  				a negative error code is returned indicating what went wrong.
  */
 int RealtimeSTT::free_buffer(std::string &result) {
+	if (!incremental)
+		return EXIT_SUCCESS;
+
 	int fsize = 0;
-	std::size_t last_position = 0;
 	int rc = stepFrameLFrontEnd(front.get(), 0, NULL, &fsize, feature_vector.get());
 	job_log->debug("[0x%X] stepFrameLFrontEnd(0x%x), fsize: %d" LOG_FMT, THREAD_ID, rc, fsize, LOG_INFO);
-	std::size_t nf = fsize / mfcc_size;
-	for (std::size_t i = 0; i < nf; ++i) {
-		if (stepSARecFrameExt(laser.get(), index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
-			return EXIT_FAILURE;
+	if (fsize > 0 && running) {
+		memcpy(&pending[pending_frames * mfcc_size], feature_vector.get(), sizeof(float) * fsize);
+		pending_frames += fsize / mfcc_size;
 	}
-	index += nf;
 
-	if (index)
-		//return get_intermediate_results(laser.get(), index, skip_position, last_position, reset_period, result);
-		return getFinalResult(laser.get(), index, last_position, feature_dim, mfcc_size, sil, result);
+	rc = EXIT_SUCCESS;
+	while (pending_frames > 0 && rc == EXIT_SUCCESS)
+		rc = step(std::min(pending_frames, mini_batch), result);
+
+	if (rc == EXIT_SUCCESS && index)
+		rc = final_result(result);
+
+	reset();
+	return rc;
+}
+
+/**
+ * @brief		새 통화를 위해 디코더와 FrontEnd 초기화
+ * @date		2026. 10. 19. 03:57:41
+ */
+void RealtimeSTT::reset() {
+	resetSLaser(laser.get());
+	resetLFrontEnd(front.get());
+	running = 0;
+	index = 0;
+	skip_position = 0;
+	last_position = 0;
+	pending_frames = 0;
+	if (endpointer)
+		endpointer->reset();
+	set_degrade(RT_DEGRADE_NONE);
+}
+
+/**
+ * @brief		RealtimeUnsegment 객체 초기화
+ * @date		2026. 10. 18. 21:05:12
+ */
+RealtimeUnsegment::RealtimeUnsegment()
+: output(LENGTH_SYNTAX) {
+	chunk.reserve(LENGTH_SYNTAX);
+}
+
+/**
+ * @brief		패킷의 인식 결과를 후처리
+ * @details		VRServer::unsegment()와 같은 결과를 만든다.
+ * @date		2026. 10. 18. 21:08:40
+ * @param[in]	cache		SPLPostProc 결과 캐시 (NULL: 사용하지 않음)
+ * @param[in]	cell_data	패킷의 STT 결과
+ * @param[out]	result		Unsegment 결과 (뒤에 추가)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise,
+ 				a negative error code is returned indicating what went wrong.
+ * @see			VRServer::unsegment()
+ */
+int RealtimeUnsegment::append(PostProcCache *cache, const std::string &cell_data, std::string &result) {
+	parseResult(cell_data.c_str(), words);
+	chunk.clear();
+	for (auto &&word : words) {
+		const char *keyword = word.word;
+		std::size_t length = word.length;
+		if ((length >= 3 && std::strncmp(keyword, "<s>", 3) == 0) ||
+			(length >= 4 && std::strncmp(keyword, "</s>", 4) == 0))
+			continue;
+
+		if (keyword[0] == '#')
+			++keyword, --length;
+
+		chunk.append(keyword, length);
+		chunk.push_back(' ');
+
+		if (chunk.size() > MAX_SYNTAX)
+			flush(cache, result);
+	}
+
+	if (!chunk.empty())
+		flush(cache, result);
+
 	return EXIT_SUCCESS;
 }
+
+void RealtimeUnsegment::flush(PostProcCache *cache, std::string &result) {
+	postProcess(cache, chunk, output.data(), result);
+	chunk.clear();
+}
@@ -0,0 +1,170 @@
+/**
+ * @file	rt_packet.cc
+ * @brief	실시간 STT 패킷
+ * @details
+ * @date	2026. 10. 19. 06:41:15
+ * @see		rt_packet.hpp
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <endian.h>
+
+#include "rt_packet.hpp"
+
+using namespace itfact::vr::node;
+
+static short __ulaw(uint8_t u) {
+	u = ~u;
+	int t = ((u & 0x0F) << 3) + 0x84;
+	t <<= (u & 0x70) >> 4;
+	return static_cast<short>((u & 0x80) ? (0x84 - t) : (t - 0x84));
+}
+
+static short __alaw(uint8_t a) {
+	a ^= 0x55;
+	int t = (a & 0x0F) << 4;
+	const int segment = (a & 0x70) >> 4;
+	if (segment == 0)
+		t += 8;
+	else if (segment == 1)
+		t += 0x108;
+	else
+		t = (t + 0x108) << (segment - 1);
+	return static_cast<short>((a & 0x80) ? t : -t);
+}
+
+/**
+ * @brief		G.711을 16bit PCM으로 변환
+ * @param[in]	data	G.711 데이터
+ * @param[in]	size	바이트 수 (= 샘플 수)
+ * @param[in]	alaw	true: A-law, false: mu-law
+ * @param[out]	pcm		16bit PCM (size 이상)
+ */
+void itfact::vr::node::decodeG711(const uint8_t *data, const std::size_t size, const bool alaw, short *pcm) {
+	static const struct table_t {
+		short ulaw[256];
+		short alaw[256];
+		table_t() {
+			for (int i = 0; i < 256; ++i) {
+				ulaw[i] = __ulaw(static_cast<uint8_t>(i));
+				alaw[i] = __alaw(static_cast<uint8_t>(i));
+			}
+		}
+	} table;
+
+	const short *lookup = alaw ? table.alaw : table.ulaw;
+	for (std::size_t i = 0; i < size; ++i)
+		pcm[i] = lookup[data[i]];
+}
+
+static int __parse_v1(const char *workload, const std::size_t size, rt_packet_t &packet, std::string &error) {
+	// CALL_ID | CMD | DATA
+	// 기존 strchr() 해석과 같이 Call ID와 명령어 길이를 제한하지 않음 (RT_PACKET_MAX_CALL_ID는 v2에만 적용)
+	const char *end = workload + size;
+	const char *delimiter = static_cast<const char *>(std::memchr(workload, '|', size));
+	if (delimiter == NULL) {
+		error = "Cannot find Call ID";
+		return EXIT_FAILURE;
+	}
+	packet.call_id.assign(workload, delimiter);
+
+	const char *command = delimiter + 1;
+	delimiter = static_cast<const char *>(std::memchr(command, '|', end - command));
+	if (delimiter == NULL) {
+		error = "Invalid argument";
+		return EXIT_FAILURE;
+	}
+	packet.command.assign(command, delimiter);
+
+	packet.version = 1;
+	packet.state = 1;
+	if (packet.command.compare(0, 4, "FIRS") == 0)
+		packet.state = 0;
+	else if (packet.command.compare(0, 4, "LAST") == 0)
+		packet.state = 2;
+	packet.sequence = 0;
+	packet.timestamp = 0;
+	packet.codec = RT_CODEC_PCM16;
+	packet.sample_rate = 8000;
+	packet.pcm = reinterpret_cast<const short *>(delimiter + 1);
+	packet.samples = (end - delimiter - 1) / sizeof(short);
+	return EXIT_SUCCESS;
+}
+
+static int __parse_v2(const char *workload, const std::size_t size, rt_packet_t &packet,
+					  std::vector<short> &decoded, std::string &error) {
+	rt_packet_header_t header;
+	if (size < sizeof(header)) {
+		error = "Truncated packet header";
+		return EXIT_FAILURE;
+	}
+	std::memcpy(&header, workload, sizeof(header));
+
+	const std::size_t header_size = le16toh(header.header_size);
+	const std::size_t call_id_size = le16toh(header.call_id_size);
+	if (header.version != RT_PACKET_VERSION || header_size < sizeof(header)) {
+		error = "Unsupported packet version " + std::to_string(header.version);
+		return EXIT_FAILURE;
+	}
+	if (call_id_size == 0 || call_id_size > RT_PACKET_MAX_CALL_ID || header_size + call_id_size > size) {
+		error = "Invalid Call ID size " + std::to_string(call_id_size);
+		return EXIT_FAILURE;
+	}
+
+	packet.version = RT_PACKET_VERSION;
+	packet.call_id.assign(workload + header_size, call_id_size);
+	packet.command.clear();
+	packet.state = (header.flags & RT_FLAG_LAST) ? 2 : ((header.flags & RT_FLAG_FIRST) ? 0 : 1);
+	packet.sequence = le32toh(header.sequence);
+	packet.timestamp = le64toh(header.timestamp);
+	packet.codec = header.codec;
+	packet.sample_rate = le16toh(header.sample_rate);
+	if (packet.sample_rate != 8000) {
+		error = "Unsupported sample rate " + std::to_string(packet.sample_rate);
+		return EXIT_FAILURE;
+	}
+
+	const char *payload = workload + header_size + call_id_size;
+	const std::size_t payload_size = size - header_size - call_id_size;
+	switch (packet.codec) {
+		case RT_CODEC_PCM16:
+			packet.pcm = reinterpret_cast<const short *>(payload);
+			packet.samples = payload_size / sizeof(short);
+			break;
+		case RT_CODEC_PCMU:
+		case RT_CODEC_PCMA:
+			decoded.resize(payload_size);
+			decodeG711(reinterpret_cast<const uint8_t *>(payload), payload_size,
+					   packet.codec == RT_CODEC_PCMA, decoded.data());
+			packet.pcm = decoded.data();
+			packet.samples = payload_size;
+			break;
+		default:
+			error = "Unsupported codec " + std::to_string(packet.codec);
+			return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		vr_realtime 패킷 해석
+ * @details		첫 바이트가 0이면 v2, 아니면 v1으로 해석한다.
+ 			G.711 데이터는 decoded에 16bit PCM으로 변환한다. 받은 시각은 해석한 시각이다.
+ * @date		2026. 10. 19. 06:52:36
+ * @param[in]	workload	작업 데이터
+ * @param[in]	size		작업 데이터 크기
+ * @param[out]	packet		해석된 패킷
+ * @param[out]	decoded		변환된 음성 데이터 버퍼
+ * @param[out]	error		실패한 이유
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int itfact::vr::node::parsePacket(const char *workload, const std::size_t size, rt_packet_t &packet,
+								  std::vector<short> &decoded, std::string &error) {
+	packet.arrival = std::chrono::steady_clock::now();
+	if (size >= 3 && workload[0] == '\0' && workload[1] == 'V' && workload[2] == 'R')
+		return __parse_v2(workload, size, packet, decoded, error);
+	return __parse_v1(workload, size, packet, error);
+}
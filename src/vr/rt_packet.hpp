@@ -0,0 +1,79 @@
+/**
+ * @headerfile	rt_packet.hpp "rt_packet.hpp"
+ * @file	rt_packet.hpp
+ * @brief	실시간 STT 패킷
+ * @details	vr_realtime 작업의 패킷을 해석한다. 두 가지 형식을 지원한다.\n
+ 			v1: "CALL_ID|CMD|DATA" (CMD가 FIRS, LAST로 시작하면 첫 패킷, 마지막 패킷이며 DATA는 8kHz 16bit PCM)\n
+ 			v2: rt_packet_header_t, Call ID, 음성 데이터 순서이며 숫자는 little endian이다.
+ 			첫 바이트가 0이므로 v1의 Call ID와 구분되며, 헤더 크기만큼만 읽고 음성 데이터는 검사하지 않는다.
+ * @date	2026. 10. 19. 06:41:15
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_RT_PACKET_H__
+#define __ITFACT_VR_RT_PACKET_H__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			static const uint8_t RT_PACKET_VERSION = 2;
+			/// v2 Call ID 최대 크기 (v1은 기존과 같이 제한하지 않음)
+			static const std::size_t RT_PACKET_MAX_CALL_ID = 256;
+
+			/// 음성 데이터 형식
+			enum RT_CODEC {
+				RT_CODEC_PCM16 = 0,		///< 16bit linear PCM
+				RT_CODEC_PCMU = 1,		///< G.711 mu-law
+				RT_CODEC_PCMA = 2		///< G.711 A-law
+			};
+
+			/// 패킷 플래그
+			enum RT_FLAG {
+				RT_FLAG_FIRST = 0x01,	///< 통화의 첫 패킷
+				RT_FLAG_LAST = 0x02		///< 통화의 마지막 패킷
+			};
+
+#pragma pack(push, 1)
+			/// v2 패킷 헤더 (24 bytes)
+			typedef struct {
+				uint8_t magic[3];		///< 0x00 'V' 'R'
+				uint8_t version;		///< RT_PACKET_VERSION
+				uint16_t header_size;	///< 헤더 크기 (이후 버전에서 늘어날 수 있음)
+				uint16_t call_id_size;	///< 헤더 뒤에 오는 Call ID 크기
+				uint32_t sequence;		///< 통화 안의 패킷 순번
+				uint64_t timestamp;		///< 녹음 시각 (us, 송신측 기준)
+				uint8_t codec;			///< RT_CODEC
+				uint8_t flags;			///< RT_FLAG
+				uint16_t sample_rate;	///< Hz (8000만 지원)
+			} rt_packet_header_t;
+#pragma pack(pop)
+
+			/// 해석된 패킷
+			typedef struct {
+				uint8_t version;		///< 1 또는 2
+				std::string call_id;
+				std::string command;	///< v1의 CMD
+				char state;				///< 0: FIRST, 1: 중간, 2: LAST
+				uint32_t sequence;		///< v2만 사용
+				uint64_t timestamp;		///< v2만 사용
+				uint8_t codec;
+				uint32_t sample_rate;
+				const short *pcm;		///< 8kHz 16bit PCM (workload 또는 decoded를 가리킴)
+				std::size_t samples;	///< 샘플 수
+				std::chrono::steady_clock::time_point arrival;	///< 받은 시각 (RealtimeScheduler의 마감 시각 기준)
+			} rt_packet_t;
+
+			int parsePacket(const char *workload, const std::size_t size, rt_packet_t &packet,
+							std::vector<short> &decoded, std::string &error);
+			void decodeG711(const uint8_t *data, const std::size_t size, const bool alaw, short *pcm);
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_RT_PACKET_H__ */
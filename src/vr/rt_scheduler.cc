@@ -0,0 +1,173 @@
+/**
+ * @file	rt_scheduler.cc
+ * @brief	실시간 STT 디코딩 스케줄러
+ * @details
+ * @date	2026. 10. 19. 09:31:12
+ * @see		rt_scheduler.hpp
+ */
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "rt_scheduler.hpp"
+
+using namespace itfact::vr::node;
+
+/// 가상 시각을 정리하는 주기 (acquire 횟수)
+static const std::size_t SWEEP_INTERVAL = 1024;
+/// 패킷이 오지 않는 받지 않은 통화를 잊기까지의 시간
+static const std::chrono::seconds REJECT_TIMEOUT(60);
+
+/**
+ * @param[in]	slots			동시에 디코딩하는 패킷 수 (0이면 1)
+ * @param[in]	deadline		받은 시각부터 디코딩을 시작해야 하는 시간
+ * @param[in]	degrade_after	deadline이 지난 후 beam을 좁히기까지의 시간
+ * @param[in]	max_waiting		기다릴 수 있는 패킷 수 (0: 제한 없음)
+ */
+RealtimeScheduler::RealtimeScheduler(const std::size_t slots, const std::chrono::milliseconds deadline,
+									 const std::chrono::milliseconds degrade_after, const std::size_t max_waiting)
+: slots(slots ? slots : 1), max_waiting(max_waiting), deadline(deadline), degrade_after(degrade_after),
+  granted(0), late(0), degraded_beam(0), shed(0), rejected(0) {
+}
+
+/**
+ * @brief		디코딩 시작
+ * @details		빈 자리가 없으면 마감 시각 순서가 될 때까지 기다린다.\n
+ 				패킷을 버리는 것은 통화를 받을 때(FIRST)뿐이며, 버린 통화의 나머지 패킷은 기다리지 않고 거절한다.
+ * @date		2026. 10. 19. 09:44:27
+ * @param[in]	call_id		Call ID
+ * @param[in]	arrival		패킷을 받은 시각 (기본값이면 지금)
+ * @param[in]	samples		패킷 샘플 수 (8kHz)
+ * @param[in]	state		패킷 상태 (0: FIRST, 1: CONT, 2: LAST)
+ * @param[out]	level		디코딩 방법 (RT_DEGRADE)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned. (기다리는 패킷이 많아 통화를 받지 않음)
+ * @see			RealtimeScheduler::release()
+ */
+int RealtimeScheduler::acquire(const std::string &call_id, const std::chrono::steady_clock::time_point arrival,
+							   const std::size_t samples, const char state, int &level) {
+	std::unique_lock<std::mutex> guard(lock);
+	const time_point_t now = std::chrono::steady_clock::now();
+	const time_point_t received = arrival == time_point_t() ? now : arrival;
+	if (++acquired % SWEEP_INTERVAL == 0)
+		sweep(now);
+
+	// 받지 않은 통화는 LAST나 새 FIRST가 올 때까지 거절
+	call_t &call = calls[call_id];
+	if (state == 0) {
+		call.rejected = false;
+	} else if (call.rejected) {
+		call.virtual_time = std::max(call.virtual_time, received);
+		if (state == 2)
+			calls.erase(call_id);
+		++rejected;
+		return EXIT_FAILURE;
+	}
+
+	// 통화의 가상 시각: 실시간보다 빨리 들어온 음성만큼 마감 시각을 늦춤
+	call.virtual_time = std::max(call.virtual_time, received) + std::chrono::microseconds(samples * 125);
+	const time_point_t key = call.virtual_time + deadline;
+
+	ticket_t ticket = {state != 0, false, false, false};
+	if (running < slots && waiting.empty()) {
+		ticket.granted = true;
+		++running;
+	} else {
+		if (max_waiting && waiting.size() >= max_waiting) {
+			// 이 패킷을 포함하여 마감 시각이 가장 늦은 FIRST 패킷을 버림
+			auto victim = waiting.end();
+			for (auto iter = waiting.begin(); iter != waiting.end(); ++iter) {
+				if (!iter->second->required)
+					victim = iter;
+			}
+			if (victim != waiting.end() && (ticket.required || victim->first > key)) {
+				victim->second->shed = true;
+				waiting.erase(victim);
+				cond.notify_all();
+			} else if (!ticket.required) {
+				++shed;
+				call.rejected = true;
+				return EXIT_FAILURE;
+			} else {
+				// 버릴 FIRST 패킷이 없으면 받은 통화의 패킷은 beam을 좁혀 빨리 처리
+				ticket.overflow = true;
+			}
+		}
+
+		waiting.insert(std::make_pair(key, &ticket));
+		cond.wait(guard, [&ticket] {return ticket.granted || ticket.shed;});
+		if (ticket.shed) {
+			++shed;
+			// 기다리는 동안 지워졌을 수 있으므로 다시 찾음
+			calls[call_id].rejected = true;
+			return EXIT_FAILURE;
+		}
+	}
+
+	const time_point_t started = std::chrono::steady_clock::now();
+	wait_latency.add(std::chrono::duration<double, std::milli>(started - now).count());
+	++granted;
+
+	const auto lateness = started - (received + deadline);
+	level = RT_DEGRADE_NONE;
+	if (lateness > std::chrono::steady_clock::duration::zero()) {
+		++late;
+		level = RT_DEGRADE_PARTIAL;
+		if (lateness > degrade_after)
+			level = RT_DEGRADE_BEAM;
+	}
+	if (ticket.overflow)
+		level = RT_DEGRADE_BEAM;
+	if (level == RT_DEGRADE_BEAM)
+		++degraded_beam;
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		디코딩 종료
+ * @details		기다리는 패킷 중 마감 시각이 가장 빠른 패킷을 시작한다.
+ */
+void RealtimeScheduler::release() {
+	std::lock_guard<std::mutex> guard(lock);
+	--running;
+	if (!waiting.empty() && running < slots) {
+		auto first = waiting.begin();
+		first->second->granted = true;
+		waiting.erase(first);
+		++running;
+		cond.notify_all();
+	}
+}
+
+/**
+ * @brief		지난 가상 시각 정리
+ * @details		가상 시각이 deadline보다 오래 지난 통화는 새 통화와 같으므로 지운다.
+ 				받지 않은 통화는 LAST 패킷을 잃은 경우에만 남으므로 REJECT_TIMEOUT이 지난 후 지운다.
+ */
+void RealtimeScheduler::sweep(const time_point_t now) {
+	for (auto iter = calls.begin(); iter != calls.end();) {
+		if (iter->second.virtual_time + (iter->second.rejected ? REJECT_TIMEOUT : deadline) < now)
+			iter = calls.erase(iter);
+		else
+			++iter;
+	}
+}
+
+void RealtimeScheduler::stats(std::string &result) {
+	std::size_t count, queued;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		count = running;
+		queued = waiting.size();
+	}
+
+	result.append("realtime.scheduler.slots\t").append(std::to_string(slots)).push_back('\n');
+	result.append("realtime.scheduler.running\t").append(std::to_string(count)).push_back('\n');
+	result.append("realtime.scheduler.waiting\t").append(std::to_string(queued)).push_back('\n');
+	result.append("realtime.scheduler.granted\t").append(std::to_string(granted.load())).push_back('\n');
+	result.append("realtime.scheduler.late\t").append(std::to_string(late.load())).push_back('\n');
+	result.append("realtime.scheduler.degraded_beam\t").append(std::to_string(degraded_beam.load())).push_back('\n');
+	result.append("realtime.scheduler.shed\t").append(std::to_string(shed.load())).push_back('\n');
+	result.append("realtime.scheduler.rejected\t").append(std::to_string(rejected.load())).push_back('\n');
+	wait_latency.stats("realtime.scheduler.wait", result);
+}
@@ -0,0 +1,99 @@
+/**
+ * @headerfile	rt_scheduler.hpp "rt_scheduler.hpp"
+ * @file	rt_scheduler.hpp
+ * @brief	실시간 STT 디코딩 스케줄러
+ * @details	vr_realtime, vr_realtime_mux, 스트리밍 연결의 디코딩을 slots개만 동시에 실행하고,
+ 			기다리는 패킷은 마감 시각이 빠른 순서(EDF)로 실행한다.\n
+ 			마감 시각은 통화별 가상 시각(앞선 패킷의 가상 시각과 받은 시각 중 늦은 시각 + 패킷 음성 길이)에
+ 			deadline을 더한 값이므로, 실시간보다 빠르게 밀려드는 통화는 마감 시각이 뒤로 밀려 다른 통화를 막지 않는다.\n
+ 			받은 시각부터 deadline이 지나 실행되는 패킷은 중간 결과를 생략하고(1단계),
+ 			degrade_after가 더 지나면 beam도 좁혀(2단계) 밀린 작업을 빨리 따라잡는다.
+ 			기다리는 패킷이 max_waiting개를 넘으면 통화 시작(FIRST) 패킷 중 마감 시각이 가장 늦은 패킷을 버리고
+ 			그 통화의 나머지 패킷도 받지 않는다.
+ 			통화 중간의 패킷을 버리면 디코더가 음성이 빠진 채로 이어서 디코딩하므로, 이미 받은 통화의 패킷은
+ 			버리지 않고 beam을 좁혀(2단계) 디코딩한다.
+ * @date	2026. 10. 19. 09:31:12
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_RT_SCHEDULER_H__
+#define __ITFACT_VR_RT_SCHEDULER_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "analytics.hpp"
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/// 스케줄러가 패킷을 버림 (VRServer::stt())
+			static const int RT_SHED = 2;
+
+			/// 늦은 패킷의 디코딩 방법
+			enum RT_DEGRADE {
+				RT_DEGRADE_NONE = 0,		///< 그대로 디코딩
+				RT_DEGRADE_PARTIAL = 1,		///< 중간 결과 생략 (다음 패킷이나 최종 결과에서 출력)
+				RT_DEGRADE_BEAM = 2			///< 중간 결과 생략 및 좁은 beam
+			};
+
+			/**
+			 * @brief	실시간 STT 디코딩 스케줄러 (EDF)
+			 */
+			class RealtimeScheduler
+			{
+			private:
+				typedef std::chrono::steady_clock::time_point time_point_t;
+				typedef struct {
+					bool required;		///< 버릴 수 없음 (받은 통화의 패킷)
+					bool overflow;		///< max_waiting을 넘어 기다림 (beam을 좁힘)
+					bool granted;
+					bool shed;
+				} ticket_t;
+				typedef struct {
+					time_point_t virtual_time;	///< 가상 시각
+					bool rejected;				///< 받지 않은 통화
+				} call_t;
+
+				std::mutex lock;
+				std::condition_variable cond;
+				std::multimap<time_point_t, ticket_t *> waiting;	///< 마감 시각 순서
+				std::unordered_map<std::string, call_t> calls;	///< 통화별 가상 시각
+				std::size_t slots;
+				std::size_t running = 0;
+				std::size_t max_waiting;
+				std::chrono::milliseconds deadline;
+				std::chrono::milliseconds degrade_after;
+				std::size_t acquired = 0;		///< 가상 시각 정리 주기 계산
+
+				std::atomic<uint64_t> granted;
+				std::atomic<uint64_t> late;
+				std::atomic<uint64_t> degraded_beam;
+				std::atomic<uint64_t> shed;
+				std::atomic<uint64_t> rejected;
+				LatencyHistogram wait_latency;
+
+			public:
+				RealtimeScheduler(const std::size_t slots, const std::chrono::milliseconds deadline,
+								  const std::chrono::milliseconds degrade_after, const std::size_t max_waiting);
+
+				int acquire(const std::string &call_id, const std::chrono::steady_clock::time_point arrival,
+							const std::size_t samples, const char state, int &level);
+				void release();
+				void stats(std::string &result);
+
+			private:
+				RealtimeScheduler();
+				void sweep(const time_point_t now);
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_RT_SCHEDULER_H__ */
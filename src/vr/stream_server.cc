@@ -0,0 +1,392 @@
+/**
+ * @file	stream_server.cc
+ * @brief	실시간 STT 스트리밍 서버
+ * @details
+ * @date	2026. 10. 19. 08:12:05
+ * @see		stream_server.hpp
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <endian.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "stream_server.hpp"
+
+#define THREAD_ID	std::this_thread::get_id()
+#define LOG_INFO	__FILE__, __FUNCTION__, __LINE__
+#define LOG_FMT		" [at %s (%s:%d)]"
+
+using namespace itfact::vr::node;
+
+/// 연결을 받는 스레드가 멈출지 확인하는 주기 (ms)
+static const int ACCEPT_INTERVAL = 500;
+static const char UNIX_PREFIX[] = "unix:";
+
+static bool __read(const int fd, void *buffer, const std::size_t size) {
+	char *data = static_cast<char *>(buffer);
+	for (std::size_t done = 0; done < size;) {
+		const ssize_t rc = ::recv(fd, data + done, size - done, 0);
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc <= 0)
+			return false;
+		done += rc;
+	}
+	return true;
+}
+
+static bool __write(const int fd, const void *buffer, const std::size_t size) {
+	const char *data = static_cast<const char *>(buffer);
+	for (std::size_t done = 0; done < size;) {
+		const ssize_t rc = ::send(fd, data + done, size - done, MSG_NOSIGNAL);
+		if (rc < 0 && errno == EINTR)
+			continue;
+		if (rc <= 0)
+			return false;
+		done += rc;
+	}
+	return true;
+}
+
+/**
+ * @brief		스트리밍 서버 생성
+ * @param[in]	handler		패킷 처리 함수
+ * @param[in]	address		"unix:경로" 또는 "호스트:포트" (호스트를 생략하면 모든 주소)
+ * @param[in]	max_connections	최대 연결 수 (0: 제한 없음)
+ * @param[in]	window		연결마다 디코딩을 기다릴 수 있는 프레임 수 (0이면 1)
+ * @param[in]	max_frame	요청 프레임 최대 크기 (bytes)
+ */
+StreamServer::StreamServer(const handler_t &handler, const std::string &address, const std::size_t max_connections,
+						   const std::size_t window, const std::size_t max_frame, log4cpp::Category *logger)
+: logger(logger), handler(handler), address(address), max_connections(max_connections),
+  window(window ? window : 1), max_frame(max_frame), running(false), accepted(0), rejected(0), frames(0),
+  bytes(0), errors(0) {
+}
+
+StreamServer::~StreamServer() {
+	stop();
+}
+
+/**
+ * @brief		연결 대기 시작
+ * @date		2026. 10. 19. 08:20:44
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int StreamServer::start() {
+	if (running)
+		return EXIT_SUCCESS;
+	if (listen() != EXIT_SUCCESS)
+		return EXIT_FAILURE;
+
+	running = true;
+	acceptor = std::thread(&StreamServer::run, this);
+	logger->info("[0x%X] Listen realtime stream on %s" LOG_FMT, THREAD_ID, address.c_str(), LOG_INFO);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		연결 대기를 멈추고 모든 연결 종료
+ * @details		디코딩 중인 프레임은 끝날 때까지 기다린다.
+ */
+void StreamServer::stop() {
+	if (running.exchange(false) && acceptor.joinable())
+		acceptor.join();
+
+	reap(true);
+	if (listen_fd >= 0) {
+		::close(listen_fd);
+		listen_fd = -1;
+		if (address.compare(0, sizeof(UNIX_PREFIX) - 1, UNIX_PREFIX) == 0)
+			::unlink(address.c_str() + sizeof(UNIX_PREFIX) - 1);
+	}
+}
+
+int StreamServer::listen() {
+	if (address.compare(0, sizeof(UNIX_PREFIX) - 1, UNIX_PREFIX) == 0) {
+		const std::string path = address.substr(sizeof(UNIX_PREFIX) - 1);
+		struct sockaddr_un addr;
+		if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+			logger->error("[0x%X] Invalid socket path: %s" LOG_FMT, THREAD_ID, path.c_str(), LOG_INFO);
+			return EXIT_FAILURE;
+		}
+		std::memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+		::unlink(path.c_str());
+		listen_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (listen_fd < 0 || ::bind(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0 ||
+			::listen(listen_fd, SOMAXCONN) != 0) {
+			logger->error("[0x%X] Cannot listen on %s: %s" LOG_FMT, THREAD_ID, address.c_str(), std::strerror(errno),
+						  LOG_INFO);
+			if (listen_fd >= 0)
+				::close(listen_fd);
+			listen_fd = -1;
+			return EXIT_FAILURE;
+		}
+		return EXIT_SUCCESS;
+	}
+
+	const std::size_t colon = address.rfind(':');
+	if (colon == std::string::npos) {
+		logger->error("[0x%X] Invalid address: %s" LOG_FMT, THREAD_ID, address.c_str(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	const std::string host = address.substr(0, colon);
+	const std::string port = address.substr(colon + 1);
+
+	struct addrinfo hints, *addresses = NULL;
+	std::memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags = AI_PASSIVE;
+	const int rc = ::getaddrinfo(host.empty() ? NULL : host.c_str(), port.c_str(), &hints, &addresses);
+	if (rc != 0) {
+		logger->error("[0x%X] Invalid address %s: %s" LOG_FMT, THREAD_ID, address.c_str(), gai_strerror(rc), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	for (struct addrinfo *ai = addresses; ai != NULL; ai = ai->ai_next) {
+		listen_fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_CLOEXEC, ai->ai_protocol);
+		if (listen_fd < 0)
+			continue;
+
+		const int on = 1;
+		::setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+		if (::bind(listen_fd, ai->ai_addr, ai->ai_addrlen) == 0 && ::listen(listen_fd, SOMAXCONN) == 0)
+			break;
+		::close(listen_fd);
+		listen_fd = -1;
+	}
+	::freeaddrinfo(addresses);
+
+	if (listen_fd < 0) {
+		logger->error("[0x%X] Cannot listen on %s: %s" LOG_FMT, THREAD_ID, address.c_str(), std::strerror(errno),
+					  LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		연결 받기
+ * @details		max_connections만큼 연결되어 있으면 새 연결은 바로 끊는다.
+ */
+void StreamServer::run() {
+	while (running) {
+		struct pollfd pfd = {listen_fd, POLLIN, 0};
+		const int rc = ::poll(&pfd, 1, ACCEPT_INTERVAL);
+		reap(false);
+		if (rc <= 0)
+			continue;
+
+		struct sockaddr_storage addr;
+		socklen_t addr_size = sizeof(addr);
+		const int fd = ::accept4(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), &addr_size, SOCK_CLOEXEC);
+		if (fd < 0)
+			continue;
+
+		char host[NI_MAXHOST] = "local", service[NI_MAXSERV] = "";
+		if (addr.ss_family != AF_UNIX) {
+			const int on = 1;
+			::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+			::getnameinfo(reinterpret_cast<struct sockaddr *>(&addr), addr_size, host, sizeof(host), service,
+						  sizeof(service), NI_NUMERICHOST | NI_NUMERICSERV);
+		}
+
+		std::lock_guard<std::mutex> guard(lock);
+		if (max_connections && connections.size() >= max_connections) {
+			logger->warn("[0x%X] Too many stream connections, reject %s" LOG_FMT, THREAD_ID, host, LOG_INFO);
+			::close(fd);
+			++rejected;
+			continue;
+		}
+
+		std::unique_ptr<connection_t> connection(new connection_t);
+		connection->fd = fd;
+		connection->peer = std::string(host) + (service[0] ? std::string(":") + service : std::string());
+		connection->eof = connection->closed = false;
+		connection->finished = 0;
+		connection->reader = std::thread(&StreamServer::receive, this, connection.get());
+		connection->decoder = std::thread(&StreamServer::decode, this, connection.get());
+		connections.push_back(std::move(connection));
+		++accepted;
+		logger->debug("[0x%X] Stream connected from %s" LOG_FMT, THREAD_ID,
+					  connections.back()->peer.c_str(), LOG_INFO);
+	}
+}
+
+/**
+ * @brief		끝난 연결 정리
+ * @param[in]	all		true: 모든 연결을 끊고 정리
+ */
+void StreamServer::reap(const bool all) {
+	std::list<std::unique_ptr<connection_t>> finished;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		for (auto iter = connections.begin(); iter != connections.end();) {
+			if (all || (*iter)->finished == 2) {
+				finished.push_back(std::move(*iter));
+				iter = connections.erase(iter);
+			} else {
+				++iter;
+			}
+		}
+	}
+
+	for (auto &&connection : finished) {
+		if (all) {
+			::shutdown(connection->fd, SHUT_RDWR);
+			std::lock_guard<std::mutex> guard(connection->lock);
+			connection->eof = true;
+			connection->cond.notify_all();
+		}
+		connection->reader.join();
+		connection->decoder.join();
+		::close(connection->fd);
+		logger->debug("[0x%X] Stream disconnected from %s" LOG_FMT, THREAD_ID, connection->peer.c_str(), LOG_INFO);
+	}
+}
+
+/**
+ * @brief		요청 프레임 수신
+ * @details		디코딩을 기다리는 프레임이 window개이면 자리가 날 때까지 수신하지 않는다.
+ */
+void StreamServer::receive(connection_t *connection) {
+	for (;;) {
+		uint32_t length;
+		if (!__read(connection->fd, &length, sizeof(length)))
+			break;
+		length = le32toh(length);
+		if (length > max_frame) {
+			logger->error("[0x%X] Frame from %s is too large (%u bytes)" LOG_FMT, THREAD_ID,
+						  connection->peer.c_str(), length, LOG_INFO);
+			++errors;
+			break;
+		}
+
+		std::vector<char> frame(length);
+		if (!__read(connection->fd, frame.data(), length))
+			break;
+		const auto received = std::chrono::steady_clock::now();
+		++frames;
+		bytes += length;
+
+		std::unique_lock<std::mutex> guard(connection->lock);
+		connection->cond.wait(guard, [this, connection] {
+			return connection->frames.size() < window || connection->closed || connection->eof;
+		});
+		if (connection->closed || connection->eof)
+			break;
+		connection->frames.push_back(std::make_pair(received, std::vector<char>()));
+		connection->frames.back().second.swap(frame);
+		connection->cond.notify_all();
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(connection->lock);
+		connection->eof = true;
+		connection->cond.notify_all();
+	}
+	++connection->finished;
+}
+
+/**
+ * @brief		요청 프레임을 순서대로 처리하여 응답
+ * @details		응답을 보낼 수 없으면 연결을 끊는다. 남은 프레임은 처리하지 않는다.
+ */
+void StreamServer::decode(connection_t *connection) {
+	std::vector<short> decoded;
+	for (;;) {
+		std::vector<char> frame;
+		std::chrono::steady_clock::time_point received;
+		{
+			std::unique_lock<std::mutex> guard(connection->lock);
+			connection->cond.wait(guard, [connection] {
+				return !connection->frames.empty() || connection->eof;
+			});
+			if (connection->frames.empty())
+				break;
+			received = connection->frames.front().first;
+			frame.swap(connection->frames.front().second);
+			connection->frames.pop_front();
+			connection->cond.notify_all();
+		}
+
+		rt_packet_t packet = rt_packet_t();
+		std::string text, error;
+		uint8_t status = STREAM_OK;
+		if (parsePacket(frame.data(), frame.size(), packet, decoded, error) != EXIT_SUCCESS) {
+			status = STREAM_ERROR;
+			text = error;
+		} else {
+			// 디코딩을 기다린 시간도 마감 시각에 포함
+			packet.arrival = received;
+			if (handler(packet, text) != EXIT_SUCCESS) {
+				status = STREAM_ERROR;
+				text = "Fail to stt";
+			}
+		}
+		if (status != STREAM_OK) {
+			logger->error("[0x%X] Stream %s, call %s: %s" LOG_FMT, THREAD_ID, connection->peer.c_str(),
+						  packet.call_id.c_str(), text.c_str(), LOG_INFO);
+			++errors;
+		}
+
+		if (!reply(connection, status, packet, text)) {
+			std::lock_guard<std::mutex> guard(connection->lock);
+			connection->closed = true;
+			connection->cond.notify_all();
+			::shutdown(connection->fd, SHUT_RDWR);
+			break;
+		}
+	}
+	++connection->finished;
+}
+
+bool StreamServer::reply(connection_t *connection, const uint8_t status, const rt_packet_t &packet,
+						 const std::string &text) {
+	const std::size_t call_id_size = std::min<std::size_t>(packet.call_id.size(), UINT16_MAX);
+	stream_reply_header_t header;
+	header.status = status;
+	header.state = static_cast<uint8_t>(packet.state);
+	header.call_id_size = htole16(static_cast<uint16_t>(call_id_size));
+	header.sequence = htole32(packet.sequence);
+	const uint32_t length = htole32(static_cast<uint32_t>(sizeof(header) + call_id_size + text.size()));
+
+	std::string buffer;
+	buffer.reserve(sizeof(length) + sizeof(header) + call_id_size + text.size());
+	buffer.append(reinterpret_cast<const char *>(&length), sizeof(length));
+	buffer.append(reinterpret_cast<const char *>(&header), sizeof(header));
+	buffer.append(packet.call_id, 0, call_id_size);
+	buffer.append(text);
+	return __write(connection->fd, buffer.data(), buffer.size());
+}
+
+void StreamServer::stats(std::string &result) {
+	std::size_t count;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		count = connections.size();
+	}
+
+	result.append("stream.address\t").append(address).push_back('\n');
+	result.append("stream.connections\t").append(std::to_string(count)).push_back('\n');
+	result.append("stream.accepted\t").append(std::to_string(accepted.load())).push_back('\n');
+	result.append("stream.rejected\t").append(std::to_string(rejected.load())).push_back('\n');
+	result.append("stream.frames\t").append(std::to_string(frames.load())).push_back('\n');
+	result.append("stream.bytes\t").append(std::to_string(bytes.load())).push_back('\n');
+	result.append("stream.errors\t").append(std::to_string(errors.load())).push_back('\n');
+}
@@ -0,0 +1,121 @@
+/**
+ * @headerfile	stream_server.hpp "stream_server.hpp"
+ * @file	stream_server.hpp
+ * @brief	실시간 STT 스트리밍 서버
+ * @details	Gearman 작업(vr_realtime) 없이 TCP 또는 Unix domain socket 연결로 실시간 음성 패킷을 받는다.\n
+ 			요청 프레임: 길이(uint32, little endian) + 패킷 (rt_packet.hpp의 v1 또는 v2 형식, vr_realtime 작업 데이터와 같음)\n
+ 			응답 프레임: 길이(uint32, little endian) + stream_reply_header_t + Call ID + 결과 (vr_realtime 작업 결과와 같음)\n
+ 			요청 프레임마다 순서대로 응답 프레임 하나를 보낸다. 한 연결에 여러 통화의 패킷을 섞어 보낼 수 있다.\n
+ 			연결마다 수신 스레드와 디코딩 스레드가 있으며, 디코딩을 기다리는 프레임이 window개가 되면
+ 			수신을 멈추므로 클라이언트는 TCP 흐름 제어로 속도가 조절된다.
+ * @date	2026. 10. 19. 08:12:05
+ * @see		rt_packet.hpp
+ */
+
+#ifndef __ITFACT_VR_STREAM_SERVER_H__
+#define __ITFACT_VR_STREAM_SERVER_H__
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <log4cpp/Category.hh>
+
+#include "rt_packet.hpp"
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/// 응답 상태
+			enum STREAM_STATUS {
+				STREAM_OK = 0,			///< 결과는 STT 결과
+				STREAM_ERROR = 1		///< 결과는 오류 메시지
+			};
+
+#pragma pack(push, 1)
+			/// 응답 프레임 헤더 (길이 다음, 8 bytes)
+			typedef struct {
+				uint8_t status;			///< STREAM_STATUS
+				uint8_t state;			///< 요청 패킷의 상태 (0: FIRST, 1: 중간, 2: LAST)
+				uint16_t call_id_size;	///< 헤더 뒤에 오는 Call ID 크기
+				uint32_t sequence;		///< 요청 패킷의 순번 (v1은 0)
+			} stream_reply_header_t;
+#pragma pack(pop)
+
+			/**
+			 * @brief	실시간 STT 스트리밍 서버
+			 */
+			class StreamServer
+			{
+			public:
+				/// 패킷 처리 (인자: 패킷, 결과), vr_realtime 작업과 같은 결과를 만든다.
+				typedef std::function<int(const rt_packet_t &, std::string &)> handler_t;
+
+			private:
+				typedef struct {
+					int fd;
+					std::string peer;
+					std::mutex lock;
+					std::condition_variable cond;
+					/// 디코딩을 기다리는 프레임 (받은 시각, 프레임)
+					std::deque<std::pair<std::chrono::steady_clock::time_point, std::vector<char>>> frames;
+					bool eof;				///< 더 받을 프레임이 없음
+					bool closed;			///< 응답을 보낼 수 없음
+					std::atomic<int> finished;	///< 끝난 스레드 수
+					std::thread reader;
+					std::thread decoder;
+				} connection_t;
+
+				log4cpp::Category *logger;
+				handler_t handler;
+				std::string address;
+				std::size_t max_connections;
+				std::size_t window;
+				std::size_t max_frame;
+
+				int listen_fd = -1;
+				std::atomic<bool> running;
+				std::thread acceptor;
+				std::mutex lock;
+				std::list<std::unique_ptr<connection_t>> connections;
+
+				std::atomic<uint64_t> accepted;
+				std::atomic<uint64_t> rejected;
+				std::atomic<uint64_t> frames;
+				std::atomic<uint64_t> bytes;
+				std::atomic<uint64_t> errors;
+
+			public:
+				StreamServer(const handler_t &handler, const std::string &address, const std::size_t max_connections,
+							 const std::size_t window, const std::size_t max_frame,
+							 log4cpp::Category *logger = &log4cpp::Category::getRoot());
+				~StreamServer();
+
+				int start();
+				void stop();
+				void stats(std::string &result);
+
+			private:
+				StreamServer();
+				int listen();
+				void run();
+				void reap(const bool all);
+				void receive(connection_t *connection);
+				void decode(connection_t *connection);
+				bool reply(connection_t *connection, const uint8_t status, const rt_packet_t &packet,
+						   const std::string &text);
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_STREAM_SERVER_H__ */
@@ -0,0 +1,830 @@
+/**
+ * @file	transcript_index.cc
+ * @brief	인식 결과 역색인
+ * @details
+ * @date	2026. 10. 19. 02:18:54
+ * @see		transcript_index.hpp
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <tuple>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <boost/filesystem.hpp>
+
+#include "transcript_index.hpp"
+
+#define THREAD_ID	std::this_thread::get_id()
+#define LOG_INFO	__FILE__, __FUNCTION__, __LINE__
+#define LOG_FMT		" [at %s (%s:%d)]"
+
+using namespace itfact::vr::node;
+
+static const char INDEX_MAGIC[8] = "VRIDX01";
+static const uint32_t INDEX_VERSION = 1;
+
+/// 저장에 실패한 경우 다시 시도할 때까지 기다리는 시간
+static const std::chrono::seconds RETRY_INTERVAL(60);
+
+/**
+ * @brief		cell data의 단어를 메모리 segment에 추가
+ * @details		"start\tend\tword\tlikelihood" 형식의 줄을 읽으며, <s> 등 '<'로 시작하는 기호는 제외한다.
+ * @return		추가한 출현 수
+ */
+static std::size_t __add_words(std::vector<std::string> &calls, std::unordered_map<std::string, uint32_t> &call_index,
+							   std::map<std::string, std::vector<index_posting_t>> &terms,
+							   const std::string &call_id, const uint32_t channel,
+							   const char *cell_data, const std::size_t size) {
+	uint32_t call;
+	auto search = call_index.find(call_id);
+	if (search == call_index.end()) {
+		call = static_cast<uint32_t>(calls.size());
+		calls.push_back(call_id);
+		call_index[call_id] = call;
+	} else {
+		call = search->second;
+	}
+
+	std::size_t count = 0;
+	const char *end = cell_data + size;
+	for (const char *line = cell_data; line < end; ) {
+		const char *eol = static_cast<const char *>(std::memchr(line, '\n', end - line));
+		if (!eol)
+			eol = end;
+
+		const char *tab1 = static_cast<const char *>(std::memchr(line, '\t', eol - line));
+		const char *tab2 = tab1 ? static_cast<const char *>(std::memchr(tab1 + 1, '\t', eol - tab1 - 1)) : NULL;
+		if (tab2 && tab2 + 1 < eol && tab2[1] != '<' && tab2[1] != '\t') {
+			const char *word = tab2 + 1;
+			const char *word_end = static_cast<const char *>(std::memchr(word, '\t', eol - word));
+			if (!word_end)
+				word_end = eol;
+
+			index_posting_t posting;
+			posting.call = call;
+			posting.channel = channel;
+			posting.start = static_cast<uint32_t>(std::strtoul(line, NULL, 10));
+			posting.end = static_cast<uint32_t>(std::strtoul(tab1 + 1, NULL, 10));
+			terms[std::string(word, word_end - word)].push_back(posting);
+			++count;
+		}
+
+		line = eol + 1;
+	}
+	return count;
+}
+
+static inline bool __posting_less(const index_posting_t &a, const index_posting_t &b) {
+	return std::tie(a.call, a.channel, a.start, a.end) < std::tie(b.call, b.channel, b.start, b.end);
+}
+
+static inline bool __match(const std::string &word, const std::string &keyword, const bool prefix) {
+	return prefix ? word.compare(0, keyword.size(), keyword) == 0 : word == keyword;
+}
+
+namespace {
+	/**
+	 * @brief	segment 파일 저장
+	 * @details	단어는 정렬된 순서로 추가해야 하며, 임시 파일에 기록한 후 close()에서 이름을 바꾼다.
+	 */
+	class SegmentWriter
+	{
+	private:
+		std::string pathname;
+		std::string tmp_pathname;
+		std::FILE *fp = NULL;
+		index_header_t header;
+		std::vector<index_call_t> calls;
+		std::unordered_map<std::string, uint32_t> call_index;
+		std::vector<index_term_t> terms;
+		std::string strings;
+		bool failed = false;
+
+	public:
+		SegmentWriter(const std::string &pathname, const uint64_t first, const uint64_t last)
+		: pathname(pathname), tmp_pathname(pathname + ".tmp") {
+			std::memset(&header, 0, sizeof(header));
+			std::memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+			header.version = INDEX_VERSION;
+			header.first = first;
+			header.last = last;
+
+			fp = std::fopen(tmp_pathname.c_str(), "wb");
+			if (fp && std::fwrite(&header, sizeof(header), 1, fp) != 1)
+				failed = true;
+		}
+
+		~SegmentWriter() {
+			if (fp) {
+				std::fclose(fp);
+				std::remove(tmp_pathname.c_str());
+			}
+		}
+
+		bool isOpen() const {return fp != NULL;};
+
+		/// 통화 ID 추가 (이미 있으면 기존 번호)
+		uint32_t addCall(const std::string &call_id) {
+			auto search = call_index.find(call_id);
+			if (search != call_index.end())
+				return search->second;
+
+			index_call_t call;
+			call.offset = strings.size();
+			call.length = static_cast<uint32_t>(call_id.size());
+			call.reserved = 0;
+			strings.append(call_id);
+
+			const uint32_t idx = static_cast<uint32_t>(calls.size());
+			calls.push_back(call);
+			call_index[call_id] = idx;
+			return idx;
+		}
+
+		void addTerm(const std::string &word, const index_posting_t *postings, const std::size_t count) {
+			if (failed || count == 0)
+				return;
+
+			index_term_t term;
+			term.offset = strings.size();
+			term.length = static_cast<uint32_t>(word.size());
+			term.reserved = 0;
+			term.postings = header.postings;
+			term.count = count;
+			strings.append(word);
+			terms.push_back(term);
+
+			if (std::fwrite(postings, sizeof(index_posting_t), count, fp) != count)
+				failed = true;
+			header.postings += count;
+		}
+
+		bool close() {
+			if (!fp)
+				return false;
+
+			header.calls = static_cast<uint32_t>(calls.size());
+			header.terms = terms.size();
+			header.calls_offset = sizeof(header) + header.postings * sizeof(index_posting_t);
+			header.terms_offset = header.calls_offset + calls.size() * sizeof(index_call_t);
+			header.strings_offset = header.terms_offset + terms.size() * sizeof(index_term_t);
+
+			bool success = !failed;
+			success = success && (calls.empty() ||
+								  std::fwrite(calls.data(), sizeof(index_call_t), calls.size(), fp) == calls.size());
+			success = success && (terms.empty() ||
+								  std::fwrite(terms.data(), sizeof(index_term_t), terms.size(), fp) == terms.size());
+			success = success && std::fwrite(strings.data(), 1, strings.size(), fp) == strings.size();
+			success = success && std::fseek(fp, 0, SEEK_SET) == 0;
+			success = success && std::fwrite(&header, sizeof(header), 1, fp) == 1;
+			success = success && std::fflush(fp) == 0 && fdatasync(fileno(fp)) == 0;
+			success = (std::fclose(fp) == 0) && success;
+			fp = NULL;
+
+			if (!success || std::rename(tmp_pathname.c_str(), pathname.c_str()) != 0) {
+				std::remove(tmp_pathname.c_str());
+				return false;
+			}
+			return true;
+		}
+	};
+}
+
+/**
+ * @brief		segment 파일 열기
+ * @details		형식이 맞지 않으면 isOpen()이 false를 반환한다.
+ * @param[in]	pathname	segment 파일
+ */
+IndexSegment::IndexSegment(const std::string &pathname) : pathname(pathname) {
+	int fd = open(pathname.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(index_header_t)) {
+		::close(fd);
+		return;
+	}
+
+	map_size = static_cast<std::size_t>(st.st_size);
+	map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (map == MAP_FAILED) {
+		map = NULL;
+		return;
+	}
+
+	const index_header_t *hdr = static_cast<const index_header_t *>(map);
+	if (std::memcmp(hdr->magic, INDEX_MAGIC, sizeof(hdr->magic)) != 0 || hdr->version != INDEX_VERSION ||
+		hdr->calls_offset != sizeof(index_header_t) + hdr->postings * sizeof(index_posting_t) ||
+		hdr->terms_offset != hdr->calls_offset + hdr->calls * sizeof(index_call_t) ||
+		hdr->strings_offset != hdr->terms_offset + hdr->terms * sizeof(index_term_t) ||
+		hdr->strings_offset > map_size)
+		return;
+
+	header = hdr;
+}
+
+IndexSegment::~IndexSegment() {
+	if (map)
+		munmap(map, map_size);
+}
+
+const char *IndexSegment::getString(const uint64_t offset) const {
+	return static_cast<const char *>(map) + header->strings_offset + offset;
+}
+
+const index_term_t *IndexSegment::getTerm(const std::size_t idx) const {
+	return reinterpret_cast<const index_term_t *>(static_cast<const char *>(map) + header->terms_offset) + idx;
+}
+
+/**
+ * @brief		word보다 작지 않은 첫 번째 단어의 위치
+ * @return		모든 단어가 word보다 작으면 getTerms()
+ */
+std::size_t IndexSegment::lowerBound(const std::string &word) const {
+	std::size_t low = 0, high = header->terms;
+	while (low < high) {
+		const std::size_t mid = low + (high - low) / 2;
+		const index_term_t *term = getTerm(mid);
+		if (word.compare(0, std::string::npos, getString(term->offset), term->length) > 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+std::string IndexSegment::getWord(const index_term_t *term) const {
+	return std::string(getString(term->offset), term->length);
+}
+
+std::string IndexSegment::getCallId(const uint32_t call) const {
+	const index_call_t *entry =
+		reinterpret_cast<const index_call_t *>(static_cast<const char *>(map) + header->calls_offset) + call;
+	return std::string(getString(entry->offset), entry->length);
+}
+
+const index_posting_t *IndexSegment::getPostings(const index_term_t *term) const {
+	return reinterpret_cast<const index_posting_t *>(static_cast<const char *>(map) + sizeof(index_header_t)) +
+		   term->postings;
+}
+
+/**
+ * @brief		색인 디렉터리의 segment를 로드하고 남아 있는 journal을 segment로 저장
+ * @details		병합 후 삭제되지 않은 segment(다른 segment의 번호 범위에 포함됨)와 저장 중 종료된 임시 파일은 삭제한다.
+ * @date		2026. 10. 19. 02:26:15
+ * @param[in]	path			색인 디렉터리
+ * @param[in]	flush_size		메모리 segment의 최대 출현 수
+ * @param[in]	merge_factor	병합을 시작하는 segment 파일 수 (2 이상)
+ */
+TranscriptIndex::TranscriptIndex(const std::string &path, const std::size_t flush_size,
+								 const std::size_t merge_factor, log4cpp::Category *logger)
+: logger(logger), path(path), flush_size(flush_size ? flush_size : 1),
+  merge_factor(std::max<std::size_t>(merge_factor, 2)) {
+	namespace fs = boost::filesystem;
+
+	if (this->path.empty() || this->path.at(this->path.size() - 1) != '/')
+		this->path.push_back('/');
+
+	std::vector<std::shared_ptr<IndexSegment>> found;
+	std::vector<uint64_t> journals;
+	try {
+		for (fs::directory_iterator iter(this->path); iter != fs::directory_iterator(); ++iter) {
+			if (!fs::is_regular_file(iter->status()))
+				continue;
+
+			const std::string name = iter->path().filename().string();
+			const std::string ext = iter->path().extension().string();
+			if (ext.compare(".tmp") == 0) {
+				fs::remove(iter->path());
+			} else if (ext.compare(".idx") == 0 && name.compare(0, 4, "seg_") == 0) {
+				std::shared_ptr<IndexSegment> segment = std::make_shared<IndexSegment>(iter->path().string());
+				if (segment->isOpen())
+					found.push_back(segment);
+				else
+					logger->error("Invalid index segment: %s", name.c_str());
+			} else if (ext.compare(".log") == 0 && name.compare(0, 8, "journal_") == 0) {
+				journals.push_back(std::strtoull(name.c_str() + 8, NULL, 10));
+			}
+		}
+	} catch (std::exception &e) {
+		logger->error("Cannot read index directory %s: %s", this->path.c_str(), e.what());
+	}
+
+	// 번호 범위가 넓은 segment가 먼저 오도록 정렬하여 병합 전 segment를 제거
+	std::sort(found.begin(), found.end(),
+		[](const std::shared_ptr<IndexSegment> &a, const std::shared_ptr<IndexSegment> &b) {
+			return a->getFirst() < b->getFirst() || (a->getFirst() == b->getFirst() && a->getLast() > b->getLast());
+		});
+	uint64_t last = 0;
+	for (auto &&segment : found) {
+		if (segment->getLast() <= last) {
+			logger->info("Remove merged index segment: %s", segment->getPathname().c_str());
+			std::remove(segment->getPathname().c_str());
+			continue;
+		}
+		segments.push_back(segment);
+		last = segment->getLast();
+	}
+	next_number = last + 1;
+
+	std::sort(journals.begin(), journals.end());
+	for (auto &&number : journals) {
+		const std::string journal = getJournalName(number);
+		next_number = std::max(next_number, number + 1);
+
+		bool flushed = false;
+		for (auto &&segment : segments)
+			flushed = flushed || (segment->getFirst() <= number && number <= segment->getLast());
+
+		if (!flushed) {
+			memtable_t memtable;
+			memtable.number = number;
+			memtable.postings = 0;
+			memtable.journal = -1;
+			replay(journal, memtable);
+			if (!writeMemtable(memtable)) {
+				logger->error("Cannot save index journal: %s", journal.c_str());
+				continue;
+			}
+
+			std::shared_ptr<IndexSegment> segment =
+				std::make_shared<IndexSegment>(getSegmentName(number, number));
+			segments.push_back(segment);
+		}
+		std::remove(journal.c_str());
+	}
+	std::sort(segments.begin(), segments.end(),
+		[](const std::shared_ptr<IndexSegment> &a, const std::shared_ptr<IndexSegment> &b) {
+			return a->getFirst() < b->getFirst();
+		});
+
+	active = createMemtable();
+	worker = std::thread(&TranscriptIndex::run, this);
+
+	logger->info("Transcript index: %s (%lu segments)", this->path.c_str(), segments.size());
+}
+
+TranscriptIndex::~TranscriptIndex() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		running = false;
+	}
+	cond.notify_all();
+	if (worker.joinable())
+		worker.join();
+
+	// 메모리 segment는 다음 실행 시 journal에서 복구
+	if (active && active->journal >= 0)
+		::close(active->journal);
+	if (frozen && frozen->journal >= 0)
+		::close(frozen->journal);
+}
+
+std::string TranscriptIndex::getSegmentName(const uint64_t first, const uint64_t last) const {
+	return path + "seg_" + std::to_string(first) + "_" + std::to_string(last) + ".idx";
+}
+
+std::string TranscriptIndex::getJournalName(const uint64_t number) const {
+	return path + "journal_" + std::to_string(number) + ".log";
+}
+
+/**
+ * @brief		새 메모리 segment와 journal 생성 (lock을 잡은 상태에서 호출)
+ */
+std::unique_ptr<TranscriptIndex::memtable_t> TranscriptIndex::createMemtable() {
+	std::unique_ptr<memtable_t> memtable(new memtable_t);
+	memtable->number = next_number++;
+	memtable->postings = 0;
+
+	const std::string journal = getJournalName(memtable->number);
+	memtable->journal = open(journal.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (memtable->journal < 0)
+		logger->error("[0x%X] Cannot open %s: %s" LOG_FMT, THREAD_ID, journal.c_str(), std::strerror(errno), LOG_INFO);
+	return memtable;
+}
+
+/**
+ * @brief		journal을 읽어 메모리 segment에 추가
+ * @details		journal 기록: <통화 ID>\\t<채널>\\t<크기>\\n<cell data>\n
+ 			기록 중 종료되어 잘린 마지막 기록은 무시한다.
+ */
+void TranscriptIndex::replay(const std::string &pathname, memtable_t &memtable) {
+	std::string data;
+	std::FILE *fp = std::fopen(pathname.c_str(), "rb");
+	if (!fp)
+		return;
+	char buffer[8192];
+	std::size_t rsize;
+	while ((rsize = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+		data.append(buffer, rsize);
+	std::fclose(fp);
+
+	std::size_t position = 0;
+	while (position < data.size()) {
+		const std::size_t eol = data.find('\n', position);
+		const std::size_t tab1 = data.find('\t', position);
+		const std::size_t tab2 = tab1 == std::string::npos ? std::string::npos : data.find('\t', tab1 + 1);
+		if (eol == std::string::npos || tab2 == std::string::npos || tab2 > eol)
+			break;
+
+		const uint32_t channel = static_cast<uint32_t>(std::strtoul(data.c_str() + tab1 + 1, NULL, 10));
+		const std::size_t size = std::strtoul(data.c_str() + tab2 + 1, NULL, 10);
+		if (eol + 1 + size > data.size())
+			break;
+
+		memtable.postings += __add_words(memtable.calls, memtable.call_index, memtable.terms,
+										 data.substr(position, tab1 - position), channel,
+										 data.data() + eol + 1, size);
+		position = eol + 1 + size;
+	}
+	logger->info("Replay index journal: %s (%lu calls)", pathname.c_str(), memtable.calls.size());
+}
+
+bool TranscriptIndex::writeMemtable(const memtable_t &memtable) {
+	SegmentWriter writer(getSegmentName(memtable.number, memtable.number), memtable.number, memtable.number);
+	if (!writer.isOpen())
+		return false;
+
+	for (auto &&call_id : memtable.calls)
+		writer.addCall(call_id);
+	for (auto &&term : memtable.terms)
+		writer.addTerm(term.first, term.second.data(), term.second.size());
+	return writer.close();
+}
+
+/**
+ * @brief		번호가 이어지는 segment들을 하나로 병합
+ * @details		단어 순으로 정렬된 각 segment를 함께 읽으며 통화 번호를 새 segment 기준으로 바꾼다.
+ */
+bool TranscriptIndex::merge(const std::vector<std::shared_ptr<IndexSegment>> &inputs) {
+	SegmentWriter writer(getSegmentName(inputs.front()->getFirst(), inputs.back()->getLast()),
+						 inputs.front()->getFirst(), inputs.back()->getLast());
+	if (!writer.isOpen())
+		return false;
+
+	std::vector<std::vector<uint32_t>> calls(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); ++i) {
+		for (uint32_t call = 0; call < inputs[i]->getCalls(); ++call)
+			calls[i].push_back(writer.addCall(inputs[i]->getCallId(call)));
+	}
+
+	std::vector<std::size_t> cursors(inputs.size(), 0);
+	std::vector<std::string> words(inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); ++i) {
+		if (inputs[i]->getTerms() > 0)
+			words[i] = inputs[i]->getWord(inputs[i]->getTerm(0));
+	}
+
+	std::vector<index_posting_t> postings;
+	while (true) {
+		const std::string *word = NULL;
+		for (std::size_t i = 0; i < inputs.size(); ++i) {
+			if (cursors[i] < inputs[i]->getTerms() && (!word || words[i] < *word))
+				word = &words[i];
+		}
+		if (!word)
+			break;
+
+		const std::string current(*word);
+		postings.clear();
+		for (std::size_t i = 0; i < inputs.size(); ++i) {
+			if (cursors[i] >= inputs[i]->getTerms() || words[i] != current)
+				continue;
+
+			const index_term_t *term = inputs[i]->getTerm(cursors[i]);
+			const index_posting_t *source = inputs[i]->getPostings(term);
+			for (uint64_t j = 0; j < term->count; ++j) {
+				postings.push_back(source[j]);
+				postings.back().call = calls[i][source[j].call];
+			}
+
+			if (++cursors[i] < inputs[i]->getTerms())
+				words[i] = inputs[i]->getWord(inputs[i]->getTerm(cursors[i]));
+		}
+
+		std::sort(postings.begin(), postings.end(), __posting_less);
+		writer.addTerm(current, postings.data(), postings.size());
+	}
+
+	return writer.close();
+}
+
+/**
+ * @brief		인식 결과 색인
+ * @details		journal에 기록한 후 메모리 segment에 추가하며, 메모리 segment가 flush_size를 넘으면
+ 			백그라운드 스레드가 segment 파일로 저장한다.
+ * @date		2026. 10. 19. 02:41:08
+ * @param[in]	call_id		통화 ID (녹취 파일 경로 등)
+ * @param[in]	channel		채널 (0: 모노 또는 왼쪽, 1: 오른쪽)
+ * @param[in]	cell_data	"start\tend\tword\tlikelihood" 형식의 인식 결과
+ * @param[in]	size		cell_data 크기
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int TranscriptIndex::add(const std::string &call_id, const uint32_t channel, const char *cell_data,
+						 const std::size_t size) {
+	std::string id(call_id);
+	std::replace(id.begin(), id.end(), '\t', ' ');
+	std::replace(id.begin(), id.end(), '\n', ' ');
+
+	std::string record(id);
+	record.push_back('\t');
+	record.append(std::to_string(channel)).push_back('\t');
+	record.append(std::to_string(size)).push_back('\n');
+	record.append(cell_data, size);
+
+	std::lock_guard<std::mutex> guard(lock);
+	if (!active)
+		return EXIT_FAILURE;
+
+	if (active->journal < 0 || ::write(active->journal, record.data(), record.size()) != (ssize_t) record.size())
+		logger->warn("[0x%X] Cannot write index journal: %s" LOG_FMT, THREAD_ID, id.c_str(), LOG_INFO);
+
+	active->postings += __add_words(active->calls, active->call_index, active->terms, id, channel, cell_data, size);
+	++documents;
+
+	if (active->postings >= flush_size && !frozen)
+		cond.notify_all();
+
+	return EXIT_SUCCESS;
+}
+
+namespace {
+	/// 검색어 하나와 일치하는 단어
+	typedef struct {
+		std::vector<index_hit_t> memory;	///< 메모리 segment에서 복사한 출현 위치
+		std::vector<std::pair<const IndexSegment *, const index_term_t *>> terms;	///< segment 파일의 단어
+		uint64_t postings;					///< 출현 수
+	} keyword_match_t;
+}
+
+/**
+ * @brief		검색어가 나오는 통화
+ * @param[in]	match	검색어와 일치하는 단어
+ * @param[in]	filter	이 통화들 중에서만 찾음 (NULL: 모든 통화)
+ * @param[out]	calls	통화 ID
+ */
+static void __match_calls(const keyword_match_t &match, const std::set<std::string> *filter,
+						  std::set<std::string> &calls) {
+	for (auto &&hit : match.memory) {
+		if (!filter || filter->count(hit.call_id))
+			calls.insert(hit.call_id);
+	}
+
+	for (auto &&entry : match.terms) {
+		const index_posting_t *postings = entry.first->getPostings(entry.second);
+		for (uint64_t j = 0; j < entry.second->count; ++j) {
+			if (j > 0 && postings[j].call == postings[j - 1].call)
+				continue;
+			std::string call_id = entry.first->getCallId(postings[j].call);
+			if (!filter || filter->count(call_id))
+				calls.insert(std::move(call_id));
+		}
+	}
+}
+
+/**
+ * @brief		키워드 검색
+ * @details		모든 키워드가 나오는 통화의 출현 위치를 통화 ID, 채널, 시작 프레임 순으로 반환한다.
+ 			'*'로 끝나는 키워드는 접두어로 검색한다.\n
+ 			출현 수가 적은 키워드의 통화부터 교집합을 구한 후, 통화 ID 순으로 limit개 통화의 출현 위치만 모은다.
+ 			메모리 segment는 일치하는 출현 위치만 복사하고 바로 lock을 풀어 add()를 막지 않는다.
+ * @date		2026. 10. 19. 02:52:30
+ * @param[in]	keywords	검색어
+ * @param[in]	limit		최대 통화 수 (0: 제한 없음)
+ * @param[out]	hits		출현 위치
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+int TranscriptIndex::search(const std::vector<std::string> &keywords, const std::size_t limit,
+							std::vector<index_hit_t> &hits) {
+	if (keywords.empty())
+		return EXIT_FAILURE;
+
+	std::vector<std::string> prefixes(keywords.size());
+	std::vector<bool> is_prefix(keywords.size());
+	for (std::size_t k = 0; k < keywords.size(); ++k) {
+		is_prefix[k] = keywords[k].size() > 1 && keywords[k].back() == '*';
+		prefixes[k] = is_prefix[k] ? keywords[k].substr(0, keywords[k].size() - 1) : keywords[k];
+	}
+
+	std::vector<std::shared_ptr<IndexSegment>> snapshot;
+	std::vector<keyword_match_t> matches(keywords.size());
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		++searches;
+		snapshot = segments;
+
+		const memtable_t *memtables[] = {frozen.get(), active.get()};
+		for (std::size_t k = 0; k < keywords.size(); ++k) {
+			for (auto &&memtable : memtables) {
+				if (!memtable)
+					continue;
+				for (auto iter = memtable->terms.lower_bound(prefixes[k]);
+					 iter != memtable->terms.end() && __match(iter->first, prefixes[k], is_prefix[k]); ++iter) {
+					for (auto &&posting : iter->second) {
+						matches[k].memory.push_back({memtable->calls[posting.call], iter->first, posting.channel,
+													 posting.start, posting.end});
+					}
+				}
+			}
+		}
+	}
+
+	for (std::size_t k = 0; k < keywords.size(); ++k) {
+		matches[k].postings = matches[k].memory.size();
+		for (auto &&segment : snapshot) {
+			for (std::size_t idx = segment->lowerBound(prefixes[k]); idx < segment->getTerms(); ++idx) {
+				const index_term_t *term = segment->getTerm(idx);
+				if (!__match(segment->getWord(term), prefixes[k], is_prefix[k]))
+					break;
+				matches[k].terms.push_back(std::make_pair(segment.get(), term));
+				matches[k].postings += term->count;
+			}
+		}
+	}
+
+	// 출현 수가 적은 키워드부터 모든 키워드가 나온 통화를 구함
+	std::vector<std::size_t> order(keywords.size());
+	for (std::size_t k = 0; k < order.size(); ++k)
+		order[k] = k;
+	std::sort(order.begin(), order.end(), [&matches](const std::size_t a, const std::size_t b) {
+		return matches[a].postings < matches[b].postings;
+	});
+
+	std::set<std::string> calls;
+	__match_calls(matches[order[0]], NULL, calls);
+	for (std::size_t i = 1; i < order.size() && !calls.empty(); ++i) {
+		std::set<std::string> next;
+		__match_calls(matches[order[i]], &calls, next);
+		calls.swap(next);
+	}
+
+	std::map<std::string, std::vector<index_hit_t>> found;
+	for (auto &&call_id : calls) {
+		if (limit && found.size() >= limit)
+			break;
+		found[call_id];
+	}
+	if (found.empty())
+		return EXIT_SUCCESS;
+
+	// 선택된 통화의 출현 위치
+	for (auto &&match : matches) {
+		for (auto &&hit : match.memory) {
+			auto search = found.find(hit.call_id);
+			if (search != found.end())
+				search->second.push_back(hit);
+		}
+
+		for (auto &&entry : match.terms) {
+			const IndexSegment *segment = entry.first;
+			const index_posting_t *postings = segment->getPostings(entry.second);
+			std::string word;
+			auto search = found.end();
+			for (uint64_t j = 0; j < entry.second->count; ++j) {
+				if (j == 0 || postings[j].call != postings[j - 1].call)
+					search = found.find(segment->getCallId(postings[j].call));
+				if (search == found.end())
+					continue;
+
+				if (word.empty())
+					word = segment->getWord(entry.second);
+				search->second.push_back({search->first, word, postings[j].channel, postings[j].start, postings[j].end});
+			}
+		}
+	}
+
+	// 다시 처리된 통화의 중복 제거
+	auto less = [](const index_hit_t &a, const index_hit_t &b) {
+		return std::tie(a.channel, a.start, a.end, a.word) < std::tie(b.channel, b.start, b.end, b.word);
+	};
+	auto equal = [](const index_hit_t &a, const index_hit_t &b) {
+		return a.channel == b.channel && a.start == b.start && a.end == b.end && a.word == b.word;
+	};
+	for (auto &&entry : found) {
+		auto &&list = entry.second;
+		std::sort(list.begin(), list.end(), less);
+		list.erase(std::unique(list.begin(), list.end(), equal), list.end());
+		hits.insert(hits.end(), list.begin(), list.end());
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		메모리 segment 저장 및 segment 병합
+ * @details		병합은 번호가 이어지는 merge_factor개의 segment 중 전체 크기가 가장 작은 것을 선택한다.
+ 			저장하지 못한 journal이 있으면 번호가 끊어지므로 그 앞뒤 segment는 병합하지 않는다.
+ */
+void TranscriptIndex::run() {
+	std::unique_lock<std::mutex> guard(lock);
+	while (running) {
+		if (!frozen && active && active->postings >= flush_size) {
+			frozen = std::move(active);
+			active = createMemtable();
+		}
+
+		if (frozen) {
+			guard.unlock();
+			const bool success = writeMemtable(*frozen);
+			std::shared_ptr<IndexSegment> segment;
+			if (success)
+				segment = std::make_shared<IndexSegment>(getSegmentName(frozen->number, frozen->number));
+			guard.lock();
+
+			if (!segment || !segment->isOpen()) {
+				logger->error("[0x%X] Cannot save index segment %lu" LOG_FMT, THREAD_ID, frozen->number, LOG_INFO);
+				cond.wait_for(guard, RETRY_INTERVAL);
+				continue;
+			}
+
+			segments.push_back(segment);
+			if (frozen->journal >= 0)
+				::close(frozen->journal);
+			std::remove(getJournalName(frozen->number).c_str());
+			frozen.reset();
+			++flushes;
+			continue;
+		}
+
+		std::size_t begin = segments.size(), min_size = 0;
+		for (std::size_t i = 0; i + merge_factor <= segments.size(); ++i) {
+			std::size_t size = segments[i]->getSize();
+			bool contiguous = true;
+			for (std::size_t j = i + 1; j < i + merge_factor && contiguous; ++j) {
+				contiguous = segments[j]->getFirst() == segments[j - 1]->getLast() + 1;
+				size += segments[j]->getSize();
+			}
+			if (contiguous && (begin == segments.size() || size < min_size)) {
+				begin = i;
+				min_size = size;
+			}
+		}
+
+		if (begin < segments.size()) {
+			std::vector<std::shared_ptr<IndexSegment>> inputs(segments.begin() + begin,
+															  segments.begin() + begin + merge_factor);
+			guard.unlock();
+			std::shared_ptr<IndexSegment> segment;
+			if (merge(inputs))
+				segment = std::make_shared<IndexSegment>(
+					getSegmentName(inputs.front()->getFirst(), inputs.back()->getLast()));
+			guard.lock();
+
+			if (!segment || !segment->isOpen()) {
+				logger->error("[0x%X] Cannot merge index segments %lu-%lu" LOG_FMT, THREAD_ID,
+							  inputs.front()->getFirst(), inputs.back()->getLast(), LOG_INFO);
+				cond.wait_for(guard, RETRY_INTERVAL);
+				continue;
+			}
+
+			// 병합 중에 추가된 segment는 뒤에 있으므로 입력 segment의 위치는 바뀌지 않음
+			segments.erase(segments.begin() + begin, segments.begin() + begin + merge_factor);
+			segments.insert(segments.begin() + begin, segment);
+			++merges;
+			for (auto &&input : inputs)
+				std::remove(input->getPathname().c_str());
+			continue;
+		}
+
+		cond.wait(guard);
+	}
+}
+
+/**
+ * @brief		색인 상태
+ * @param[out]	result	"항목\t값" 형식의 줄
+ */
+void TranscriptIndex::stats(std::string &result) {
+	std::lock_guard<std::mutex> guard(lock);
+	std::size_t size = 0;
+	uint64_t postings = 0;
+	for (auto &&segment : segments) {
+		size += segment->getSize();
+		postings += segment->getPostings();
+	}
+	const std::size_t memory = (active ? active->postings : 0) + (frozen ? frozen->postings : 0);
+
+	result.append("index.segments\t").append(std::to_string(segments.size())).push_back('\n');
+	result.append("index.size\t").append(std::to_string(size)).push_back('\n');
+	result.append("index.postings\t").append(std::to_string(postings + memory)).push_back('\n');
+	result.append("index.memory_postings\t").append(std::to_string(memory)).push_back('\n');
+	result.append("index.documents\t").append(std::to_string(documents)).push_back('\n');
+	result.append("index.flushes\t").append(std::to_string(flushes)).push_back('\n');
+	result.append("index.merges\t").append(std::to_string(merges)).push_back('\n');
+	result.append("index.searches\t").append(std::to_string(searches)).push_back('\n');
+}
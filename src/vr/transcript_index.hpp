@@ -0,0 +1,175 @@
+/**
+ * @headerfile	transcript_index.hpp "transcript_index.hpp"
+ * @file	transcript_index.hpp
+ * @brief	인식 결과 역색인
+ * @details	STT가 끝날 때마다 결과의 단어를 "단어 -> (통화, 채널, 시작, 종료)" 형식으로 로컬 디스크에 색인하여
+ 			보관된 결과 파일 전체를 검색하지 않고 키워드를 찾을 수 있게 한다.\n
+ 			새 결과는 journal에 기록한 후 메모리 segment에 추가하며, 일정 크기가 되면 정렬된
+ 			segment 파일로 저장한다. segment 파일이 많아지면 백그라운드 스레드가 이웃한 파일을 병합한다.\n
+ 			파일 구성: index_header_t, index_posting_t*, index_call_t*, index_term_t*, 문자열\n
+ 			segment 파일명: seg_<첫 번호>_<마지막 번호>.idx, journal 파일명: journal_<번호>.log
+ * @date	2026. 10. 19. 02:10:37
+ * @see		vr.hpp
+ */
+
+#ifndef __ITFACT_VR_TRANSCRIPT_INDEX_H__
+#define __ITFACT_VR_TRANSCRIPT_INDEX_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <log4cpp/Category.hh>
+
+namespace itfact {
+	namespace vr {
+		namespace node {
+			/// segment 파일 헤더
+			typedef struct {
+				char magic[8];			///< "VRIDX01"
+				uint32_t version;
+				uint32_t calls;			///< 통화 수
+				uint64_t terms;			///< 단어 수
+				uint64_t postings;		///< 출현 수
+				uint64_t first;			///< 포함된 첫 번째 segment 번호
+				uint64_t last;			///< 포함된 마지막 segment 번호
+				uint64_t calls_offset;
+				uint64_t terms_offset;
+				uint64_t strings_offset;
+				uint8_t reserved[16];
+			} index_header_t;
+
+			/// 단어 출현 위치
+			typedef struct {
+				uint32_t call;			///< segment 안의 통화 번호
+				uint32_t channel;
+				uint32_t start;			///< 시작 프레임
+				uint32_t end;			///< 종료 프레임
+			} index_posting_t;
+
+			/// 통화 목록 항목
+			typedef struct {
+				uint64_t offset;		///< 통화 ID (문자열 영역 기준)
+				uint32_t length;
+				uint32_t reserved;
+			} index_call_t;
+
+			/// 단어 목록 항목 (단어 순으로 정렬됨)
+			typedef struct {
+				uint64_t offset;		///< 단어 (문자열 영역 기준)
+				uint32_t length;
+				uint32_t reserved;
+				uint64_t postings;		///< 첫 번째 출현 위치 (index_posting_t 단위)
+				uint64_t count;			///< 출현 수
+			} index_term_t;
+
+			/// 검색 결과
+			typedef struct {
+				std::string call_id;
+				std::string word;
+				uint32_t channel;
+				uint32_t start;
+				uint32_t end;
+			} index_hit_t;
+
+			/**
+			 * @brief	segment 파일 읽기 (mmap)
+			 */
+			class IndexSegment
+			{
+			private:
+				std::string pathname;
+				void *map = NULL;
+				std::size_t map_size = 0;
+				const index_header_t *header = NULL;
+
+			public:
+				explicit IndexSegment(const std::string &pathname);
+				~IndexSegment();
+
+				bool isOpen() const {return header != NULL;};
+				const std::string &getPathname() const {return pathname;};
+				uint64_t getFirst() const {return header->first;};
+				uint64_t getLast() const {return header->last;};
+				std::size_t getSize() const {return map_size;};
+				uint64_t getTerms() const {return header->terms;};
+				uint64_t getPostings() const {return header->postings;};
+				uint32_t getCalls() const {return header->calls;};
+
+				const index_term_t *getTerm(const std::size_t idx) const;
+				std::size_t lowerBound(const std::string &word) const;
+				std::string getWord(const index_term_t *term) const;
+				std::string getCallId(const uint32_t call) const;
+				const index_posting_t *getPostings(const index_term_t *term) const;
+
+			private:
+				IndexSegment();
+				const char *getString(const uint64_t offset) const;
+			};
+
+			/**
+			 * @brief	디스크 기반 인식 결과 역색인
+			 */
+			class TranscriptIndex
+			{
+			private:
+				/// 메모리 segment
+				typedef struct {
+					uint64_t number;
+					std::vector<std::string> calls;
+					std::unordered_map<std::string, uint32_t> call_index;
+					std::map<std::string, std::vector<index_posting_t>> terms;
+					std::size_t postings;
+					int journal;
+				} memtable_t;
+
+				log4cpp::Category *logger;
+				std::string path;
+				std::size_t flush_size;		///< 메모리 segment의 최대 출현 수
+				std::size_t merge_factor;	///< 병합을 시작하는 segment 파일 수
+
+				std::mutex lock;
+				std::condition_variable cond;
+				std::unique_ptr<memtable_t> active;		///< 추가 중인 메모리 segment
+				std::unique_ptr<memtable_t> frozen;		///< 파일로 저장 중인 메모리 segment
+				std::vector<std::shared_ptr<IndexSegment>> segments;	///< 번호 순서
+				uint64_t next_number = 1;
+				bool running = true;
+				std::thread worker;
+
+				uint64_t documents = 0;
+				uint64_t searches = 0;
+				uint64_t flushes = 0;
+				uint64_t merges = 0;
+
+			public:
+				TranscriptIndex(const std::string &path, const std::size_t flush_size, const std::size_t merge_factor,
+								log4cpp::Category *logger = &log4cpp::Category::getRoot());
+				~TranscriptIndex();
+
+				int add(const std::string &call_id, const uint32_t channel, const char *cell_data, const std::size_t size);
+				int search(const std::vector<std::string> &keywords, const std::size_t limit,
+						   std::vector<index_hit_t> &hits);
+				void stats(std::string &result);
+
+			private:
+				TranscriptIndex();
+				std::string getSegmentName(const uint64_t first, const uint64_t last) const;
+				std::string getJournalName(const uint64_t number) const;
+				std::unique_ptr<memtable_t> createMemtable();
+				void replay(const std::string &pathname, memtable_t &memtable);
+				bool writeMemtable(const memtable_t &memtable);
+				bool merge(const std::vector<std::shared_ptr<IndexSegment>> &inputs);
+				void run();
+			};
+		}
+	}
+}
+
+#endif /* __ITFACT_VR_TRANSCRIPT_INDEX_H__ */
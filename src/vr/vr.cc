@@ -7,10 +7,16 @@
  * @todo	ETRI API 중 스레드 세이프하지 않은 함수들이 존재하여 동기화할 필요가 있음
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
 #include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include <omp.h>
+#include <sys/stat.h>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -18,6 +24,11 @@
 
 #include "ETRIPP.h"
 
+#include "feature_store.hpp"
+#include "hash.hpp"
+#include "memory_file.hpp"
+#include "process.hpp"
+#include "result_parser.hpp"
 #include "vr.hpp"
 
 using namespace itfact::vr::node;
@@ -51,6 +62,49 @@ static int errorHandler(int a_errCode, char *a_errMsg) {
 	return a_errCode;
 }
 
+/**
+ * @brief		CPU 배치
+ * @details		Gearman 워커, 엔진 LB 스레드, OpenMP 스레드가 서로 다른 CPU를 사용하도록
+ 			topology.gearman_core, stt.engine_core, topology.omp_core 순서로 CPU를 배정한다.\n
+ 			topology.gearman_core가 0(기본값)이면 Gearman 워커는 엔진 집합을 제외한 모든 CPU를 사용한다.
+ 			디코딩은 OpenMP 집합으로 옮겨 실행하므로, unsegment, ssp, batch 등 나머지 작업이 CPU 하나에 몰리지 않는다.\n
+ 			OpenMP 스레드 수는 디코딩을 수행하는 워커(stt, realtime) 수로 OpenMP 집합을 나눈 값이다.
+ * @date		2026. 10. 18. 13:52:16
+ * @see			loadLaserModule()
+ */
+void VRServer::configureTopology() {
+	const itfact::common::Configuration *config = getConfig();
+	itfact::common::Topology *topology = getTopology();
+
+	unsigned long engine_core = static_cast<unsigned long>(DEFAULT_ENGINE_CORE);
+	engine_core = config->getConfig<unsigned long>("stt.engine_core", engine_core);
+	unsigned long gearman_core = config->getConfig<unsigned long>("topology.gearman_core", 0UL);
+	unsigned long omp_core = config->getConfig<unsigned long>("topology.omp_core", 0UL);
+
+	if (topology->getTotal() <= gearman_core + engine_core) {
+		logger->warn("Not enough CPUs(%lu) for topology (gearman: %lu, engine: %lu)",
+					 topology->getTotal(), gearman_core, engine_core);
+		return;
+	}
+
+	if (gearman_core)
+		topology->assign("gearman", gearman_core);
+	topology->assign("engine", engine_core);
+	topology->assign("omp", omp_core);
+	if (!gearman_core)
+		topology->assignExcept("gearman", {"engine"});
+
+	unsigned long decoders = getTotalWorkers("stt") + getTotalWorkers("realtime");
+	if (decoders == 0)
+		decoders = 1;
+	omp_threads = topology->getCount("omp") / decoders;
+	if (omp_threads == 0)
+		omp_threads = 1;
+	omp_threads = config->getConfig<unsigned long>("topology.omp_threads", omp_threads);
+
+	logger->info("CPU topology: %s (omp_threads: %lu)", topology->toString().c_str(), omp_threads);
+}
+
 /**
  * @brief		Load Laser module
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
@@ -68,6 +122,10 @@ bool VRServer::loadLaserModule() {
 	unsigned long engine_core = static_cast<unsigned long>(DEFAULT_ENGINE_CORE);
 	engine_core = config->getConfig<unsigned long>("stt.engine_core", engine_core);
 	logger->info("load LASER(%s) module with %d cores", (useGPU ? "GPU" : "CPU"), engine_core);
+
+	// 엔진이 생성하는 LB 스레드는 engine 집합을 상속받음
+	std::unique_ptr<itfact::common::ScopedAffinity> affinity(
+		new itfact::common::ScopedAffinity(getTopology()->getCpuSet("engine")));
 	setLaserErrorHandleProc(NULL, (void *) errorHandler);
 	setSLaserLBCores(engine_core);
 	usleep(5 * 1024 * 1024);
@@ -225,6 +283,8 @@ bool VRServer::loadLaserModule() {
 	for (int i = 1; i <= 10; ++i)
 		memcpy(sil + i * (mfcc_size * 100), sil, sizeof(float) * mfcc_size * 100);
 
+	affinity.reset();
+
 	// unsegment 초기화 
 	if (getTotalWorkers("unsegment") > 0) {
 		if (!Lat2cnWordNbestOutInit(
@@ -239,6 +299,25 @@ bool VRServer::loadLaserModule() {
 		}
 	}
 
+	// SPLPostProc 결과 캐시 (사용자 사전 및 태깅 모델이 로드된 동안만 유효)
+	unsigned long postproc_cache_size =
+		config->getConfig<unsigned long>("unsegment.postproc_cache_size", 32UL * 1024 * 1024);
+	if (postproc_cache_size > 0) {
+		std::ostringstream source;
+		const std::string *dictionaries[] = {&tagging_file, &chunking_file, &user_dic_file};
+		for (auto &&dictionary : dictionaries) {
+			struct stat st;
+			source << *dictionary << '\t';
+			if (stat(dictionary->c_str(), &st) == 0)
+				source << st.st_size << '\t' << st.st_mtime;
+			source << '\n';
+		}
+		std::string data = source.str();
+		postproc_cache = std::make_shared<PostProcCache>(postproc_cache_size,
+			config->getConfig<unsigned long>("unsegment.postproc_cache_shards", 16UL),
+			itfact::common::toHex(itfact::common::hash128(data.data(), data.size())).substr(0, 16));
+	}
+
 	minimum_confidence = getConfig()->getConfig("stt.minimum_confidence", minimum_confidence);
 
 	return true;
@@ -273,11 +352,60 @@ void VRServer::unloadLaserModule() {
 
 	if (sil)
 		free(sil);
+	if (postproc_cache)
+		postproc_cache->clear();
 	closeSPLPostProc();
 
 	//master_laser = NULL;
 }
 
+/**
+ * @brief		STT 결과 캐시 설정
+ * @details		모델 파일(경로, 크기, 수정 시각), 엔진 및 FrontEnd 설정 파일 내용, 디코딩 설정으로
+ 			fingerprint를 만들어 캐시 키에 포함하므로 모델이나 설정이 바뀌면 이전 결과는 사용되지 않는다.
+ * @date		2026. 10. 18. 16:21:09
+ * @see			ResultCache
+ */
+void VRServer::configureResultCache() {
+	const itfact::common::Configuration *config = getConfig();
+	std::ostringstream source;
+
+	const std::string *models[] = {&am_file, &fsm_file, &sym_file, &dnn_file, &prior_file, &norm_file};
+	for (auto &&model : models) {
+		struct stat st;
+		source << *model << '\t';
+		if (stat(model->c_str(), &st) == 0)
+			source << st.st_size << '\t' << st.st_mtime;
+		source << '\n';
+	}
+
+	std::string laser_config = config->getConfig("stt.laser_config", default_config.laser_config.c_str());
+	const std::string *configs[] = {&laser_config, &frontend_config};
+	for (auto &&pathname : configs) {
+		std::ifstream input(*pathname);
+		source << input.rdbuf() << '\n';
+	}
+
+	source << mfcc_size << '\t' << mini_batch << '\t' << prior_weight << '\t'
+		<< config->getConfig("stt.reset_period", RESET_PERIOD) << '\n';
+
+	std::string data = source.str();
+	fingerprint = itfact::common::toHex(itfact::common::hash128(data.data(), data.size())).substr(0, 16);
+	logger->info("Model fingerprint: %s", fingerprint.c_str());
+
+	if (!config->isSet("stt.cache_path"))
+		return;
+
+	std::string cache_path = config->getConfig("stt.cache_path");
+	if (!itfact::common::checkPath(cache_path, true)) {
+		logger->error("Cannot create stt.cache_path: %s", cache_path.c_str());
+		return;
+	}
+
+	unsigned long cache_size = config->getConfig<unsigned long>("stt.cache_size", 1024UL * 1024 * 1024);
+	result_cache = std::make_shared<ResultCache>(cache_path, cache_size, logger);
+}
+
 /**
  * @brief		특징 벡터로부터 최종 인식 결과를 가져옴
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
@@ -304,10 +432,7 @@ int itfact::vr::node::getFinalResult(
 	float * const sil,
 	std::string &buffer
 ) {
-	int start = 0;
-	int end = 0;
-	char keyword[LENGTH_KEYWORD];
-	float like = 0.0; // likelihood
+	static thread_local std::vector<result_word_t> words;
 
 	for (int i = 0; i < 40; ++i) {
 		if (stepSARecFrameExt(laser, index + i, feature_dim, sil + i * mfcc_size) != EXIT_SUCCESS) {
@@ -320,30 +445,17 @@ int itfact::vr::node::getFinalResult(
 	// 단어 경계를 고려한 인식열에 대한 정렬이 완료된 최종 인식 결과를 가져옴
 	char *resultP = getWBAdjustedResultSLaser(laser, index + 40, 1, true);
 	if (resultP != NULL) {
-		std::string tmp_resultP(resultP);
-		tmp_resultP.push_back('\0');
-		std::vector<std::string> v_result;
-		boost::split(v_result, tmp_resultP, boost::is_any_of("\n"));
-		for (auto &&line : v_result) {
-			memset(keyword, 0x00, LENGTH_KEYWORD);
-			if (sscanf(line.c_str(), "%d %d %s %f", &start, &end, keyword, &like) < 4)
-				continue;
-			char *tmp_keyword = keyword;
-
-			// if (tmp_keyword[0] == '#')
-			// 	++tmp_keyword;
+		parseResult(resultP, words);
+		for (auto &&word : words) {
+			// if (word.word[0] == '#')
+			// 	++word.word, --word.length;
 
-			buffer.append(boost::lexical_cast<std::string>(start + last_position));
-			buffer.push_back('\t');
-			buffer.append(boost::lexical_cast<std::string>(end + last_position));
-			buffer.push_back('\t');
-			buffer.append(tmp_keyword, std::strlen(tmp_keyword));
-			buffer.push_back('\t');
-			buffer.append(boost::lexical_cast<std::string>(like));
-			buffer.push_back('\n');
+			appendWord(buffer, word.start + last_position, word.end + last_position,
+					   word.word, word.length, word.like);
 		}
 
-		last_position += end;
+		if (!words.empty())
+			last_position += words.back().end;
 
 		return EXIT_SUCCESS;
 	} else {
@@ -352,12 +464,6 @@ int itfact::vr::node::getFinalResult(
 	}
 }
 
-typedef struct {
-	std::size_t start;
-	std::size_t end;
-	std::string keyword;
-	double like;
-} cell_t;
 /**
  * @brief		특징 벡터로부터 중간 인식 결과를 가져옴
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
@@ -380,53 +486,43 @@ int itfact::vr::node::getIntermediateResults(
 	const float minimum_confidence,
 	const std::size_t end_position
 ) {
-	std::size_t start = 0;
-	std::size_t end = 0;
-	char keyword[LENGTH_KEYWORD];
-	float like = 0.0; // likelihood
+	static thread_local std::vector<result_word_t> words;
 
 	char *result = getWBAdjustedResultSLaser(laser, index, 1, true);
 	// char *result = getResultSLaser(laser, index, 1, true);
 	if (result != NULL) {
-		std::string str_result(result);
-		str_result.push_back('\0');
-
-		std::vector<std::string> v_result;
-		std::vector<cell_t> temp_results;
-		boost::split(v_result, str_result, boost::is_any_of("\n"));
-		for (auto &&line : v_result) {
-			memset(keyword, 0x00, LENGTH_KEYWORD);
-			if (sscanf(line.c_str(), "%lu %lu %s %f", &start, &end, keyword, &like) < 4)
-				continue;
-			char *tmp_keyword = keyword;
-
-			if (tmp_keyword[0] == '#')
-				++tmp_keyword;
-
-			if (std::strlen(tmp_keyword) == 0 || tmp_keyword[0] == '<')
+		// 출력할 단어만 앞쪽에 남김
+		parseResult(result, words);
+		std::size_t count = 0;
+		for (auto &&word : words) {
+			if (word.word[0] == '#')
+				++word.word, --word.length;
+
+			if (word.length == 0 || word.word[0] == '<')
 				continue;
 
-			if (start + last_position <= skip_position)
+			const std::size_t start = static_cast<std::size_t>(word.start) + last_position;
+			const std::size_t end = static_cast<std::size_t>(word.end) + last_position;
+			if (start <= skip_position)
 				continue;
 
-			if (end_position < end + last_position)
+			if (end_position < end)
 				break;
 
-			cell_t temp;
-			temp.start = start + last_position;
-			temp.end = end + last_position;
-			temp.keyword = tmp_keyword;
-			temp.like = like;
-			temp_results.push_back(temp);
+			result_word_t &cell = words[count++];
+			cell = word;
+			cell.start = static_cast<long>(start);
+			cell.end = static_cast<long>(end);
 		}
+		words.resize(count);
 
-		if (temp_results.size() > 0) {
-			skip_position = temp_results[temp_results.size() - 1].start;
-			for (size_t i = temp_results.size() - 1; i > 0; --i) {
-				if (temp_results[i].like > minimum_confidence)
+		if (words.size() > 0) {
+			skip_position = words[words.size() - 1].start;
+			for (size_t i = words.size() - 1; i > 0; --i) {
+				if (words[i].like > minimum_confidence)
 					break;
-				skip_position = i > 0 ? temp_results[i - 1].start : 
-					temp_results[i].start > 0 ? temp_results[i].start - 1 : temp_results[i].start;
+				skip_position = i > 0 ? words[i - 1].start : 
+					words[i].start > 0 ? words[i].start - 1 : words[i].start;
 			}
 		}
 
@@ -438,14 +534,14 @@ int itfact::vr::node::getIntermediateResults(
 		// 		break;
 		// }
 
-		for (auto &&cell : temp_results) {
-			buffer.append(boost::lexical_cast<std::string>(cell.start));
+		for (auto &&cell : words) {
+			appendNumber(buffer, cell.start);
 			buffer.push_back('\t');
-			buffer.append(boost::lexical_cast<std::string>(cell.end));
+			appendNumber(buffer, cell.end);
 			buffer.push_back('\t');
-			buffer.append(cell.keyword);
+			buffer.append(cell.word, cell.length);
 			buffer.push_back('\t');
-			buffer.append(boost::lexical_cast<std::string>(cell.like));
+			appendNumber(buffer, static_cast<double>(cell.like));
 			buffer.push_back('\n');
 		}
 
@@ -456,65 +552,95 @@ int itfact::vr::node::getIntermediateResults(
 	}
 }
 
-/**
-* @brief		Speech to text
-* @author		Youngsoo Min (ysmin@itfact.co.kr)
-* @author		Kijeong Khil (kjkhil@itfact.co.kr)
-* @date		2016. 04. 19. 17:32
-* @param[in]	buffer		녹취 데이터
-* @param[in]	bufferLen	녹취 데이터 길이
-* @param[out]	result		STT 결과
-* @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
-Otherwise,
-a negative error code is returned indicating what went wrong.
-* @see			VRServer::unsegment()
-*/
-int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thread_num, std::string &result) {
-	std::size_t read_size = 80 * mini_batch;	// 8kHz Sampling Rate 포맷에서 80 Smaple이 1 frame에 해당함.
-	std::size_t reset_period = getConfig()->getConfig("stt.reset_period", RESET_PERIOD);
-	unsigned long i;
-	int rc;
+static const char CHECKPOINT_MAGIC[] = "VRCKPT1";
 
-	LFrontEnd *_pFront = createLFrontEndExt(FRONTEND_OPTION_8KHZFRONTEND | FRONTEND_OPTION_DNNFBFRONTEND);
-	if (_pFront == NULL) {
-		logger->error("[0x%X] Fail to createLFrontEndExt" LOG_FMT, THREAD_ID, LOG_INFO);
+/**
+ * @brief		체크포인트 저장
+ * @details		mkstemp()로 만든 임시 파일에 기록한 후 rename()으로 교체하므로 저장 도중 종료되더라도 이전 체크포인트가 유지된다.
+ * @date		2026. 10. 18. 14:42:10
+ * @param[in]	pathname		체크포인트 파일
+ * @param[in]	offset			다시 시작할 샘플 위치
+ * @param[in]	last_position	마지막 종료 위치
+ * @param[in]	samples			녹취 데이터 길이 (샘플 수)
+ * @param[in]	partial			offset까지의 STT 결과
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			loadCheckpoint()
+ */
+static int saveCheckpoint(const std::string &pathname, const std::size_t offset,
+						  const std::size_t last_position, const std::size_t samples,
+						  const std::string &partial) {
+	// 같은 체크포인트를 여러 작업이 저장하더라도 서로의 임시 파일을 덮어쓰지 않도록 고유한 이름을 사용
+	std::string tmp_pathname(pathname);
+	tmp_pathname.append(".XXXXXX");
+
+	const int fd = mkstemp(&tmp_pathname[0]);
+	if (fd < 0)
+		return EXIT_FAILURE;
+	std::FILE *fp = fdopen(fd, "wb");
+	if (!fp) {
+		close(fd);
+		std::remove(tmp_pathname.c_str());
 		return EXIT_FAILURE;
 	}
-	std::shared_ptr<LFrontEnd> pFront(_pFront, closeLFrontEnd);
 
-	if ((rc = readOptionLFrontEnd(pFront.get(), const_cast<char *>(frontend_config.c_str()))) != 0) {
-		logger->error("[0x%X] Fail to readOptionFrontEnd: %s" LOG_FMT, THREAD_ID, frontend_config.c_str(), LOG_INFO);
+	bool success = std::fprintf(fp, "%s\n%lu\n%lu\n%lu\n%lu\n", CHECKPOINT_MAGIC, offset,
+								last_position, samples, partial.size()) > 0;
+	success = success && std::fwrite(partial.data(), 1, partial.size(), fp) == partial.size();
+	success = success && std::fflush(fp) == 0 && fsync(fileno(fp)) == 0;
+	std::fclose(fp);
+
+	if (!success || std::rename(tmp_pathname.c_str(), pathname.c_str()) != 0) {
+		std::remove(tmp_pathname.c_str());
 		return EXIT_FAILURE;
 	}
+	return EXIT_SUCCESS;
+}
 
-	if ((rc = setOptionLFrontEnd(pFront.get(), (char *)"FRONTEND_OPTION_DOEPD", (char *)"0")) != 0) {
-		logger->error("[0x%X] Fail to setOptionLFrontEnd" LOG_FMT, THREAD_ID, LOG_INFO);
+/**
+ * @brief		체크포인트 로드
+ * @details		녹취 데이터 길이가 다르면 다른 녹취의 체크포인트이므로 사용하지 않는다.
+ * @date		2026. 10. 18. 14:48:37
+ * @param[in]	pathname		체크포인트 파일
+ * @param[in]	samples			녹취 데이터 길이 (샘플 수)
+ * @param[out]	offset			다시 시작할 샘플 위치
+ * @param[out]	last_position	마지막 종료 위치
+ * @param[out]	partial			offset까지의 STT 결과
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			saveCheckpoint()
+ */
+static int loadCheckpoint(const std::string &pathname, const std::size_t samples,
+						  std::size_t &offset, std::size_t &last_position, std::string &partial) {
+	std::FILE *file = std::fopen(pathname.c_str(), "rb");
+	if (!file)
 		return EXIT_FAILURE;
-	}
+	std::shared_ptr<std::FILE> fp(file, std::fclose);
 
-	if ((rc = setOptionLFrontEnd(pFront.get(), (char *)"CMS_LEN_BLOCK", (char *)"0")) != 0) {
-		logger->error("[0x%X] Fail to setOptionLFrontEnd" LOG_FMT, THREAD_ID, LOG_INFO);
+	char magic[sizeof(CHECKPOINT_MAGIC) + 1];
+	unsigned long _offset, _last_position, _samples, length;
+	if (std::fscanf(fp.get(), "%8s %lu %lu %lu %lu", magic, &_offset, &_last_position, &_samples, &length) != 5 ||
+		std::strcmp(magic, CHECKPOINT_MAGIC) != 0 || _samples != samples || _offset > samples)
 		return EXIT_FAILURE;
-	}
+	std::fgetc(fp.get());
 
-	/*
-	Laser *_lP =
-		createChildLaserDNN(master_laser,
-			const_cast<char *>(am_file.c_str()),
-			const_cast<char *>(dnn_file.c_str()),
-			prior_weight,
-			const_cast<char *>(prior_file.c_str()),
-			const_cast<char *>(norm_file.c_str()),
-			mini_batch, (useGPU ? 1L : 0), idGPU,
-			const_cast<char *>(fsm_file.c_str()),
-			const_cast<char *>(sym_file.c_str()));
-	if (_lP == NULL) {
-		logger->error("[0x%X] fail to createChildLaserDNN" LOG_FMT, THREAD_ID, LOG_INFO);
+	partial.resize(length);
+	if (length > 0 && std::fread(&partial[0], 1, length, fp.get()) != length)
 		return EXIT_FAILURE;
-	}
-	std::shared_ptr<Laser> lP(_lP, freeChildLaserDNN);
-	*/
 
+	offset = _offset;
+	last_position = _last_position;
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		디코딩용 child laser 생성
+ * @details		GPU가 2개인 경우 작업 순서에 따라 번갈아 할당한다.
+ * @date		2026. 10. 18. 18:05:37
+ * @return		생성된 Laser (freeChildLaserDNN()으로 해제).\n
+ 				Otherwise, a NULL is returned.
+ */
+Laser *VRServer::createChildLaser() {
 	Laser *_lP = NULL;
 
 	if (numGPU < 2) {
@@ -530,7 +656,7 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 				const_cast<char *>(sym_file.c_str()));
 		if (_lP == NULL) {
 			logger->error("[0x%X] fail to createChildLaserDNN" LOG_FMT, THREAD_ID, LOG_INFO);
-			return EXIT_FAILURE;
+			return NULL;
 		}
 	}
 	else if (numGPU == 2) {
@@ -551,7 +677,7 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 					const_cast<char *>(sym_file.c_str()));
 			if (_lP == NULL) {
 				logger->error("[0x%X] fail to createChildLaserDNN" LOG_FMT, THREAD_ID, LOG_INFO);
-				return EXIT_FAILURE;
+				return NULL;
 			}
 		}
 		else {
@@ -567,12 +693,112 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 					const_cast<char *>(sym_file.c_str()));
 			if (_lP == NULL) {
 				logger->error("[0x%X] fail to createChildLaserDNN" LOG_FMT, THREAD_ID, LOG_INFO);
-				return EXIT_FAILURE;
+				return NULL;
 			}
 		}
 
 		stt_job_count++;
 	}
+	return _lP;
+}
+
+/**
+* @brief		Speech to text
+* @details		option->checkpoint가 지정된 경우 reset_period 마다 진행 상황을 저장하며,
+			저장된 체크포인트가 있으면 해당 위치부터 이어서 처리한다.\n
+			option->feature_file이 지정된 경우 FrontEnd 출력을 저장하여 stt_feature()로 다시 디코딩할 수 있게 한다.\n
+			처리가 끝나면 완료된 체크포인트를 남기며, 결과 전송 후 호출한 쪽에서 삭제한다.
+* @author		Youngsoo Min (ysmin@itfact.co.kr)
+* @author		Kijeong Khil (kjkhil@itfact.co.kr)
+* @date		2016. 04. 19. 17:32
+* @param[in]	buffer		녹취 데이터
+* @param[in]	bufferLen	녹취 데이터 길이
+* @param[out]	result		STT 결과
+* @param[in]	option		작업별 옵션
+* @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+Otherwise,
+a negative error code is returned indicating what went wrong.
+* @see			VRServer::unsegment()
+*/
+int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thread_num, std::string &result,
+				  const stt_option_t *option) {
+	std::size_t read_size = 80 * mini_batch;	// 8kHz Sampling Rate 포맷에서 80 Smaple이 1 frame에 해당함.
+	std::size_t reset_period = getConfig()->getConfig("stt.reset_period", RESET_PERIOD);
+	unsigned long i;
+	int rc;
+
+	itfact::common::ScopedAffinity affinity(getTopology()->getCpuSet("omp"));
+	if (omp_threads)
+		omp_set_num_threads(static_cast<int>(omp_threads));
+
+	// 체크포인트 확인
+	const std::size_t result_base = result.size();
+	const bool use_checkpoint = option && !option->checkpoint.empty();
+	std::size_t start_offset = 0;
+	std::size_t resume_position = 0;
+	if (use_checkpoint) {
+		std::string partial;
+		if (loadCheckpoint(option->checkpoint, bufferLen, start_offset, resume_position, partial) == EXIT_SUCCESS) {
+			logger->info("[0x%X] Resume from %s (offset: %lu/%lu)" LOG_FMT,
+				THREAD_ID, option->checkpoint.c_str(), start_offset, bufferLen, LOG_INFO);
+			result.append(partial);
+
+			// 이어서 처리하면 FrontEnd 출력이 달라지므로 녹취 전체의 특징 벡터를 따로 저장
+			if (start_offset > 0 && !option->feature_file.empty())
+				save_feature(buffer, bufferLen, option->feature_file, option->feature_compress);
+			if (start_offset >= bufferLen)
+				return EXIT_SUCCESS;
+		}
+	}
+
+	LFrontEnd *_pFront = createLFrontEndExt(FRONTEND_OPTION_8KHZFRONTEND | FRONTEND_OPTION_DNNFBFRONTEND);
+	if (_pFront == NULL) {
+		logger->error("[0x%X] Fail to createLFrontEndExt" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	std::shared_ptr<LFrontEnd> pFront(_pFront, closeLFrontEnd);
+
+	// 통화 분석: 체크포인트에서 이어서 처리하는 경우 앞부분은 디코딩하지 않으므로 바로 분석
+	SpeechAnalytics *analytics = option ? option->analytics : NULL;
+	if (analytics && start_offset > 0)
+		analytics->append(buffer, start_offset);
+
+	if ((rc = readOptionLFrontEnd(pFront.get(), const_cast<char *>(frontend_config.c_str()))) != 0) {
+		logger->error("[0x%X] Fail to readOptionFrontEnd: %s" LOG_FMT, THREAD_ID, frontend_config.c_str(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	if ((rc = setOptionLFrontEnd(pFront.get(), (char *)"FRONTEND_OPTION_DOEPD", (char *)"0")) != 0) {
+		logger->error("[0x%X] Fail to setOptionLFrontEnd" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	if ((rc = setOptionLFrontEnd(pFront.get(), (char *)"CMS_LEN_BLOCK", (char *)"0")) != 0) {
+		logger->error("[0x%X] Fail to setOptionLFrontEnd" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	/*
+	Laser *_lP =
+		createChildLaserDNN(master_laser,
+			const_cast<char *>(am_file.c_str()),
+			const_cast<char *>(dnn_file.c_str()),
+			prior_weight,
+			const_cast<char *>(prior_file.c_str()),
+			const_cast<char *>(norm_file.c_str()),
+			mini_batch, (useGPU ? 1L : 0), idGPU,
+			const_cast<char *>(fsm_file.c_str()),
+			const_cast<char *>(sym_file.c_str()));
+	if (_lP == NULL) {
+		logger->error("[0x%X] fail to createChildLaserDNN" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	std::shared_ptr<Laser> lP(_lP, freeChildLaserDNN);
+	*/
+
+	Laser *_lP = createChildLaser();
+	if (_lP == NULL)
+		return EXIT_FAILURE;
 	//std::shared_ptr<Laser> lP(_lP, freeChildLaserDLNet);
 	//////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -598,8 +824,20 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 	resetSLaser(_lP);
 	resetLFrontEnd(pFront.get());
 
+	// 특징 벡터 저장 (이어서 처리하는 경우 save_feature()로 이미 저장함)
+	std::unique_ptr<FeatureWriter> feature_writer;
+	if (option && !option->feature_file.empty() && start_offset == 0) {
+		feature_writer.reset(new FeatureWriter(option->feature_file, mfcc_size, mini_batch,
+											   bufferLen, option->feature_compress));
+		if (!feature_writer->isOpen()) {
+			logger->warn("[0x%X] Cannot write feature: %s" LOG_FMT,
+				THREAD_ID, option->feature_file.c_str(), LOG_INFO);
+			feature_writer.reset();
+		}
+	}
+
 	// 녹취 파일을 읽어가며 처리
-	std::size_t offset = 0;
+	std::size_t offset = start_offset;
 	std::size_t index = 0;
 	for (; offset < bufferLen; offset += read_size) {
 		int fsize = 0;
@@ -608,6 +846,8 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 		if (rsize > remain)
 			rsize = remain;
 
+		if (analytics)
+			analytics->append(&buffer[offset], rsize);
 		rc = stepFrameLFrontEnd(pFront.get(), rsize, const_cast<short *>(&buffer[offset]), &fsize, temp_buffer.get());
 		logger->debug("[0x%X] stepFrameLFrontEnd(0x%x), read: %d, fsize: %d" LOG_FMT,
 			THREAD_ID, rc, rsize, fsize, LOG_INFO);
@@ -628,6 +868,9 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 		if (nf < mini_batch)
 			memcpy(feature_vector.get() + nf * mfcc_size, sil, sizeof(float) * mfcc_size * (mini_batch - nf));
 
+		if (feature_writer && feature_writer->write(FEATURE_FIRST, feature_vector.get(), nf) != EXIT_SUCCESS)
+			feature_writer.reset();
+
 		for (i = 0; i < nf; ++i) {
 			// 특징 벡터의 차원 값을 추가적으로 사용하여 프레임 기반의 탐색을 수행 (feature_dim = 128 * 600)
 			//if (stepSARecFrameExt(lP.get(), index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
@@ -642,7 +885,7 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 	offset += read_size;
 	logger->debug("[0x%X] index: %d, offset: %d" LOG_FMT, THREAD_ID, index, offset, LOG_INFO);
 
-	std::size_t last_position = 0;
+	std::size_t last_position = resume_position;
 	int fsize = 0;
 	for (; offset < bufferLen; offset += read_size) {
 		std::size_t rsize = read_size;
@@ -651,6 +894,8 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 			rsize = remain;
 
 		// 음성 신호로부터 특징 벡터 출력
+		if (analytics)
+			analytics->append(&buffer[offset], rsize);
 		rc = stepFrameLFrontEnd(pFront.get(), rsize, const_cast<short *>(&buffer[offset]), &fsize, feature_vector.get());
 		// if (rc)
 		//logger->debug("[0x%X] stepFrameLFrontEnd(0x%x), read: %d, fsize: %d" LOG_FMT, THREAD_ID, rc, rsize, fsize, LOG_INFO);
@@ -694,6 +939,9 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 		if (nf < mini_batch)
 			memcpy(feature_vector.get() + nf * mfcc_size, sil, sizeof(float) * mfcc_size * (mini_batch - nf));
 
+		if (feature_writer && feature_writer->write(FEATURE_CHUNK, feature_vector.get(), nf) != EXIT_SUCCESS)
+			feature_writer.reset();
+
 		for (i = 0; i < nf; ++i) {
 			// 특징 벡터의 차원 값을 추가적으로 사용하여 프레임 기반의 탐색을 수행 (feature_dim = 128 * 600)
 			//if (stepSARecFrameExt(lP.get(), index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
@@ -717,6 +965,12 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 			}
 
 			index = 0;
+
+			// LFrontEnd 내부에 남아있는 몇 프레임은 다시 시작할 때 버려진다.
+			if (use_checkpoint && saveCheckpoint(option->checkpoint, offset + rsize, last_position,
+												 bufferLen, result.substr(result_base)))
+				logger->warn("[0x%X] Fail to save checkpoint: %s" LOG_FMT,
+					THREAD_ID, option->checkpoint.c_str(), LOG_INFO);
 		}
 	}
 
@@ -724,6 +978,8 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 	rc = stepFrameLFrontEnd(pFront.get(), 0, NULL, &fsize, feature_vector.get());
 	logger->debug("[0x%X] stepFrameLFrontEnd(0x%x), fsize: %d" LOG_FMT, THREAD_ID, rc, fsize, LOG_INFO);
 	std::size_t nf = fsize / mfcc_size;
+	if (feature_writer && feature_writer->write(FEATURE_FLUSH, feature_vector.get(), nf) != EXIT_SUCCESS)
+		feature_writer.reset();
 	for (i = 0; i < nf; ++i) {
 		//if (stepSARecFrameExt(lP.get(), index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
 		if (stepSARecFrameExt(_lP, index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
@@ -743,10 +999,214 @@ int VRServer::stt(const short *buffer, const std::size_t bufferLen, long stt_thr
 		resetSLaser(_lP);
 		freeChildLaserDNN(_lP);
 	}
+
+	if (feature_writer && feature_writer->close() != EXIT_SUCCESS)
+		logger->warn("[0x%X] Cannot write feature: %s" LOG_FMT, THREAD_ID, option->feature_file.c_str(), LOG_INFO);
+
+	// 2채널 녹취는 다른 채널이 실패하더라도 완료된 채널을 다시 처리하지 않도록 완료 상태를 남김
+	if (use_checkpoint && saveCheckpoint(option->checkpoint, bufferLen, last_position,
+										 bufferLen, result.substr(result_base)))
+		logger->warn("[0x%X] Fail to save checkpoint: %s" LOG_FMT, THREAD_ID, option->checkpoint.c_str(), LOG_INFO);
 	
 	return EXIT_SUCCESS;
 }
 
+/**
+ * @brief		저장된 특징 벡터로 다시 디코딩
+ * @details		stt()에서 option->feature_file로 저장한 파일을 읽어 FrontEnd 없이 디코딩한다.
+ 			구간별 sil 패딩과 reset_period 처리는 stt()와 같다.
+ * @date		2026. 10. 18. 18:24:16
+ * @param[in]	pathname	특징 벡터 파일
+ * @param[out]	result		STT 결과
+ * @param[out]	samples		원본 녹취 데이터 길이 (샘플 수)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			VRServer::stt()
+ */
+int VRServer::stt_feature(const std::string &pathname, std::string &result, std::size_t &samples) {
+	std::size_t reset_period = getConfig()->getConfig("stt.reset_period", RESET_PERIOD);
+	std::size_t i;
+
+	FeatureReader reader(pathname);
+	if (!reader.isOpen()) {
+		logger->error("[0x%X] Invalid feature file: %s" LOG_FMT, THREAD_ID, pathname.c_str(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	if (reader.getMfccSize() != mfcc_size || reader.getMiniBatch() != mini_batch) {
+		logger->error("[0x%X] Feature dimension mismatch: %s (mfcc_size: %lu, mini_batch: %lu)" LOG_FMT,
+			THREAD_ID, pathname.c_str(), reader.getMfccSize(), reader.getMiniBatch(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	samples = reader.getSamples();
+
+	itfact::common::ScopedAffinity affinity(getTopology()->getCpuSet("omp"));
+	if (omp_threads)
+		omp_set_num_threads(static_cast<int>(omp_threads));
+
+	const std::size_t max_frames = mini_batch + LDA_LEN_FRAMESTACK;
+	float *_feature_vector = (float *)malloc(sizeof(float) * mfcc_size * max_frames);
+	if (_feature_vector == NULL) {
+		logger->error("[0x%X] %s [at %s]", THREAD_ID, std::strerror(errno), "feature vector");
+		return EXIT_FAILURE;
+	}
+	std::shared_ptr<float> feature_vector(_feature_vector, free);
+
+	Laser *_lP = createChildLaser();
+	if (_lP == NULL)
+		return EXIT_FAILURE;
+	std::shared_ptr<Laser> lP(_lP, [](Laser *laser) {
+		resetSLaser(laser);
+		freeChildLaserDNN(laser);
+	});
+	resetSLaser(_lP);
+
+	std::size_t index = 0;
+	std::size_t last_position = 0;
+	std::size_t records = 0;
+	enum FEATURE_RECORD type;
+	std::size_t nf;
+	for (; reader.next(type, feature_vector.get(), max_frames, nf) == EXIT_SUCCESS; ++records) {
+		if (type != FEATURE_FLUSH && nf < mini_batch)
+			memcpy(feature_vector.get() + nf * mfcc_size, sil, sizeof(float) * mfcc_size * (mini_batch - nf));
+
+		for (i = 0; i < nf; ++i) {
+			if (stepSARecFrameExt(_lP, index + i, feature_dim, feature_vector.get() + i * mfcc_size) != EXIT_SUCCESS)
+				return EXIT_FAILURE;
+		}
+		index += nf;
+
+		if (type == FEATURE_CHUNK && index > reset_period) {
+			if (getFinalResult(_lP, index, last_position, feature_dim, mfcc_size, sil, result) != EXIT_SUCCESS)
+				continue;
+
+			logger->debug("[0x%X] Reset LASER (last position: %lu)" LOG_FMT, THREAD_ID, last_position, LOG_INFO);
+			if (resetSLaser(_lP)) {
+				logger->error("[0x%X] Fail to resetSLaser" LOG_FMT, THREAD_ID, LOG_INFO);
+				return EXIT_FAILURE;
+			}
+			index = 0;
+		}
+	}
+
+	if (records != reader.getRecords()) {
+		logger->error("[0x%X] Broken feature file: %s (%lu/%lu records)" LOG_FMT,
+			THREAD_ID, pathname.c_str(), records, reader.getRecords(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	if (index > 0) {
+		if (getFinalResult(_lP, index, last_position, feature_dim, mfcc_size, sil, result) != EXIT_SUCCESS)
+			return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		특징 벡터만 저장
+ * @details		결과 캐시나 체크포인트로 디코딩하지 않은 녹취도 stt_feature()로 다시 디코딩할 수 있도록
+ 			stt()와 같은 구간으로 FrontEnd 출력을 저장한다.
+ * @date		2026. 10. 19. 10:24:51
+ * @param[in]	buffer		녹취 데이터
+ * @param[in]	bufferLen	녹취 데이터 길이
+ * @param[in]	pathname	특징 벡터 파일
+ * @param[in]	compress	8bit 압축 여부
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			VRServer::stt(), VRServer::stt_feature()
+ */
+int VRServer::save_feature(const short *buffer, const std::size_t bufferLen, const std::string &pathname,
+						   const bool compress) {
+	const std::size_t read_size = 80 * mini_batch;
+	std::size_t i;
+
+	LFrontEnd *_pFront = createLFrontEndExt(FRONTEND_OPTION_8KHZFRONTEND | FRONTEND_OPTION_DNNFBFRONTEND);
+	if (_pFront == NULL) {
+		logger->error("[0x%X] Fail to createLFrontEndExt" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	std::shared_ptr<LFrontEnd> pFront(_pFront, closeLFrontEnd);
+
+	if (readOptionLFrontEnd(pFront.get(), const_cast<char *>(frontend_config.c_str())) != 0 ||
+		setOptionLFrontEnd(pFront.get(), (char *)"FRONTEND_OPTION_DOEPD", (char *)"0") != 0 ||
+		setOptionLFrontEnd(pFront.get(), (char *)"CMS_LEN_BLOCK", (char *)"0") != 0) {
+		logger->error("[0x%X] Fail to setOptionLFrontEnd" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	resetLFrontEnd(pFront.get());
+
+	std::vector<float> feature_vector(mfcc_size * (mini_batch + LDA_LEN_FRAMESTACK));
+	std::vector<float> temp_buffer(mfcc_size * mini_batch);
+
+	FeatureWriter writer(pathname, mfcc_size, mini_batch, bufferLen, compress);
+	if (!writer.isOpen()) {
+		logger->warn("[0x%X] Cannot write feature: %s" LOG_FMT, THREAD_ID, pathname.c_str(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	bool first = true;
+	int fsize = 0;
+	for (std::size_t offset = 0; offset < bufferLen; offset += read_size) {
+		const std::size_t rsize = std::min(read_size, bufferLen - offset);
+		if (first) {
+			stepFrameLFrontEnd(pFront.get(), rsize, const_cast<short *>(&buffer[offset]), &fsize, temp_buffer.data());
+			if (fsize <= 0)
+				continue;
+
+			// 첫 구간은 LDA 프레임 스택만큼 첫 프레임을 반복 (stt()와 같음)
+			for (i = 0; i < LDA_LEN_FRAMESTACK; ++i)
+				memcpy(feature_vector.data() + i * mfcc_size, temp_buffer.data(), sizeof(float) * mfcc_size);
+			memcpy(feature_vector.data() + i * mfcc_size, temp_buffer.data(), sizeof(float) * fsize);
+			fsize = fsize + i * mfcc_size;
+		} else {
+			stepFrameLFrontEnd(pFront.get(), rsize, const_cast<short *>(&buffer[offset]), &fsize, feature_vector.data());
+			if (fsize <= 0)
+				continue;
+		}
+
+		if (writer.write(first ? FEATURE_FIRST : FEATURE_CHUNK, feature_vector.data(), fsize / mfcc_size)) {
+			logger->warn("[0x%X] Cannot write feature: %s" LOG_FMT, THREAD_ID, pathname.c_str(), LOG_INFO);
+			return EXIT_FAILURE;
+		}
+		first = false;
+	}
+
+	stepFrameLFrontEnd(pFront.get(), 0, NULL, &fsize, feature_vector.data());
+	if (writer.write(FEATURE_FLUSH, feature_vector.data(), fsize > 0 ? fsize / mfcc_size : 0) ||
+		writer.close()) {
+		logger->warn("[0x%X] Cannot write feature: %s" LOG_FMT, THREAD_ID, pathname.c_str(), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		SPLPostProc 수행
+ * @details		cache가 있으면 같은 입력의 결과를 재사용한다.
+ * @date		2026. 10. 18. 22:47:03
+ * @param[in]	cache	SPLPostProc 결과 캐시 (NULL: 사용하지 않음)
+ * @param[in]	chunk	SPLPostProc 입력
+ * @param[in]	output	SPLPostProc 출력 버퍼 (LENGTH_SYNTAX bytes)
+ * @param[out]	result	후처리 결과 (뒤에 추가)
+ */
+void itfact::vr::node::postProcess(PostProcCache *cache, const std::string &chunk, char *output,
+								   std::string &result) {
+	if (cache) {
+		static thread_local std::string value;
+		if (cache->get(chunk, value)) {
+			result.append(value);
+			return;
+		}
+	}
+
+	std::memset(output, 0x00, LENGTH_SYNTAX);
+	SPLPostProc(const_cast<char *>(chunk.c_str()), output);
+	result.append(output);
+	if (cache)
+		cache->put(chunk, output);
+}
+
 /**
  * @brief		Unsegment 
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
@@ -785,18 +1245,15 @@ int VRServer::unsegment(const std::string &cell_data, std::string &result) {
 		tmp_buf.push_back(' ');
 
 		if (tmp_buf.size() > MAX_SYNTAX) {
-			memset(tmp_buf1, 0x00, LENGTH_SYNTAX);
-			SPLPostProc(const_cast<char *>(tmp_buf.c_str()), tmp_buf1);
+			postProcess(postproc_cache.get(), tmp_buf, tmp_buf1, result);
 			// SPLPostProcSentenceSegment_POS(tmp_buf1, tmp_buf2);
-			result.append(tmp_buf1);
 			tmp_buf = "";
 		}
 	}
 
 	if (tmp_buf.size() > 0) {
-		SPLPostProc(const_cast<char *>(tmp_buf.c_str()), tmp_buf1);
+		postProcess(postproc_cache.get(), tmp_buf, tmp_buf1, result);
 		// SPLPostProcSentenceSegment_POS(tmp_buf1, tmp_buf2);
-		result.append(tmp_buf1);
 	}
 
 	// logger->debug("[0x%X] unsegment result : %s" LOG_FMT, THREAD_ID, result.c_str(), LOG_INFO);
@@ -804,6 +1261,23 @@ int VRServer::unsegment(const std::string &cell_data, std::string &result) {
 	return EXIT_SUCCESS;
 }
 
+/**
+ * @brief		실시간 Unsegment
+ * @details		패킷의 STT 결과에는 그 패킷에서 새로 확정된 단어만 있으므로 통화별 상태 없이 그 단어만 후처리한다.
+ 			파싱 및 SPLPostProc 버퍼는 작업 스레드별 RealtimeUnsegment를 재사용한다.
+ * @date		2026. 10. 18. 21:16:27
+ * @param[in]	cell_data	패킷의 STT 결과
+ * @param[out]	result		Unsegment 결과 (뒤에 추가)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise,
+ 				a negative error code is returned indicating what went wrong.
+ * @see			RealtimeUnsegment::append()
+ */
+int VRServer::unsegment_realtime(const std::string &cell_data, std::string &result) {
+	static thread_local RealtimeUnsegment buffers;
+	return buffers.append(postproc_cache.get(), cell_data, result);
+}
+
 /**
  * @brief		Unsegment with time
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
@@ -835,6 +1309,46 @@ int VRServer::unsegment_with_time(const std::string &mlf_file, const std::string
 	return EXIT_SUCCESS;
 }
 
+/**
+ * @brief		Unsegment with time (메모리)
+ * @details		MLF와 결과 텍스트를 메모리 파일(/proc/self/fd)로 SPLPostProcMLF에 전달하여
+ 				임시 디렉터리에 파일을 만들지 않는다.
+ 				결과는 줄 단위로 읽은 것과 같도록 마지막 줄에도 개행 문자가 붙는다.
+ * @date		2026. 10. 18. 21:58:12
+ * @param[in]	mlf		MLF 데이터
+ * @param[in]	size	MLF 데이터 크기
+ * @param[out]	text	Unsegment 결과 (뒤에 추가됨)
+ * @param[in]	pause	Pause 길이
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			VRServer::unsegment_with_time()
+ */
+int VRServer::unsegment_with_time(const char *mlf, const std::size_t size, std::string &text, int pause) {
+	itfact::common::MemoryFile mlf_file("unsegment.mlf");
+	itfact::common::MemoryFile text_file("unsegment.txt");
+	if (!mlf_file.isOpen() || !text_file.isOpen()) {
+		logger->error("[0x%X] Cannot create memory file: %s" LOG_FMT, THREAD_ID, std::strerror(errno), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	if (mlf_file.write(mlf, size)) {
+		logger->error("[0x%X] Cannot write MLF: %s" LOG_FMT, THREAD_ID, std::strerror(errno), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+
+	if (unsegment_with_time(mlf_file.getPath(), text_file.getPath(), pause))
+		return EXIT_FAILURE;
+
+	const std::size_t base = text.size();
+	if (text_file.read(text)) {
+		logger->error("[0x%X] Cannot read unsegment result: %s" LOG_FMT, THREAD_ID, std::strerror(errno), LOG_INFO);
+		return EXIT_FAILURE;
+	}
+	if (text.size() > base && text.at(text.size() - 1) != '\n')
+		text.push_back('\n');
+
+	return EXIT_SUCCESS;
+}
+
 // v: 0, 1 = 0
 // l: 0 = 0
 // rate: 0, 0xF = 0
@@ -869,6 +1383,79 @@ const long sampling_rate[4][4] = {
 	{44100, 48000, 32000, 0}, // version: 1
 };
 
+/**
+ * @brief		CLS 항목의 정수 값 (ts=, te=)
+ * @param[in,out]	p	검색 시작 위치 (값 다음으로 이동)
+ */
+static inline bool __cls_number(const char *&p, const char *end, const char *key, long &value) {
+	const std::size_t key_length = std::strlen(key);
+	const char *found = std::search(p, end, key, key + key_length);
+	if (found == end)
+		return false;
+
+	p = found + key_length;
+	while (p < end && (*p == ' ' || *p == '\t'))
+		++p;
+	bool negative = p < end && *p == '-';
+	if (negative)
+		++p;
+	if (p == end || *p < '0' || *p > '9')
+		return false;
+	for (value = 0; p < end && *p >= '0' && *p <= '9'; ++p)
+		value = value * 10 + (*p - '0');
+	if (negative)
+		value = -value;
+	return true;
+}
+
+/**
+ * @brief		CLS 출력에서 화자 구간 추출
+ * @details		"ts= <시작>, te= <끝>, [ <화자>=<점수> <화자>=<점수> ], str= <문장>" 형식의 줄을
+ 			복사하지 않고 제자리에서 파싱하여 첫 번째 화자가 s0(묵음)이 아닌 구간을
+ 			"<시작>\t<끝>\t<화자>\n" 형식으로 buf에 추가한다.
+ * @date		2026. 10. 19. 00:12:48
+ * @param[in]	data	CLS 출력
+ * @param[in]	size	CLS 출력 크기
+ * @param[out]	buf		화자 구간 (뒤에 추가)
+ * @return		형식이 맞지 않아 무시한 줄 수
+ */
+static std::size_t __parse_cls(const char *data, const std::size_t size, std::string &buf) {
+	std::size_t invalid = 0;
+	const char *end = data + size;
+	for (const char *line = data; line < end; ) {
+		const char *eol = static_cast<const char *>(std::memchr(line, '\n', end - line));
+		if (!eol)
+			eol = end;
+
+		const char *p = line;
+		long ts = 0, te = 0;
+		if (__cls_number(p, eol, "ts=", ts) && __cls_number(p, eol, "te=", te) &&
+			(p = static_cast<const char *>(std::memchr(p, '[', eol - p))) != NULL) {
+			for (++p; p < eol && (*p == ' ' || *p == '\t'); ++p)
+				;
+			const char *label = p;
+			while (p < eol && *p != '=' && *p != ' ' && *p != '\t' && *p != ']')
+				++p;
+			const std::size_t length = p - label;
+			if (p < eol && *p == '=' && length > 0) {
+				if (length != 2 || std::strncmp(label, "s0", 2) != 0) {
+					appendNumber(buf, ts);
+					buf.push_back('\t');
+					appendNumber(buf, te);
+					buf.push_back('\t');
+					buf.append(label, length);
+					buf.push_back('\n');
+				}
+			} else
+				++invalid;
+		} else if (eol > line && !(eol - line == 1 && *line == '\r'))
+			++invalid;
+
+		line = eol + 1;
+	}
+	return invalid;
+}
+
 /**
  * @brief		ssp 
  * @author		Youngsoo Min (ysmin@itfact.co.kr)
@@ -882,124 +1469,220 @@ const long sampling_rate[4][4] = {
  * @see			VRServer::stt()
  */
 int VRServer::ssp(const std::string &mlf_file, std::string &buf) {
-	int result = 0;
-	typedef struct s_t {
-		char s[16];
-		float value;
-	} S_T;
-
-	/* cls file format */
-	typedef struct cls_t {
-		int ts;
-		int te;
-		S_T first;
-		S_T second;
-		char str[4096];
-	} CLS_T;
-
 	std::string cls_file(mlf_file);
 	cls_file.append(".cls");
 
 	// convert mlf to cls using tool (MlfClassify_new.exe)
 	std::string default_pathname = "./bin/MlfClassify_new.exe";
+	const long timeout = getConfig()->getConfig("ssp.timeout", 60000L);
 	if (getConfig()->isSet("ssp.util")) {
-		char *part = NULL;
-		size_t len = 0;
-		ssize_t read;
-
-		std::string cmd(getConfig()->getConfig("ssp.util"));
-		cmd.push_back(' ');
-		cmd.append(mlf_file);
-		cmd.push_back('>');
-		cmd.append(cls_file);
-
-		job_log->debug("[0x%X] %s", THREAD_ID, cmd.c_str());
-		int rc = std::system(cmd.c_str());
+		// 표준 출력을 파이프로 바로 읽음 (cls 파일을 만들지 않음)
+		std::vector<std::string> argv = itfact::common::splitCommand(getConfig()->getConfig("ssp.util"));
+		argv.push_back(mlf_file);
+
+		job_log->debug("[0x%X] %s", THREAD_ID, itfact::common::toString(argv).c_str());
+		buf = "";
+		int rc = itfact::common::execute(argv, timeout, NULL, &buf);
 		if (rc) {
-			job_log->error("[0x%X] Error(%d) occurred during execution '%s'", THREAD_ID, rc, cmd.c_str());
+			job_log->error("[0x%X] Error(%d) occurred during execution '%s'",
+				THREAD_ID, rc, itfact::common::toString(argv).c_str());
+			return EXIT_FAILURE;
+		}
+	} else {
+		std::vector<std::string> argv = {default_pathname, "./out", mlf_file, cls_file, "5", "500"};
+		int rc = itfact::common::execute(argv, timeout);
+		if (rc) {
+			job_log->error("[0x%X] Error(%d) occurred during execution '%s'",
+				THREAD_ID, rc, itfact::common::toString(argv).c_str());
+			std::remove(cls_file.c_str());
 			return EXIT_FAILURE;
 		}
 
-		std::FILE *fp = fopen(cls_file.c_str(), "rt");
-		if (!fp) {
+		// read cls and extract data
+		std::ifstream input(cls_file, std::ios::binary);
+		if (!input.is_open()) {
 			job_log->error("[0x%X] Cannot open file: %s", THREAD_ID, cls_file.c_str());
 			return EXIT_FAILURE;
 		}
-		std::shared_ptr<FILE> fi_cls(fp, fclose);
+		std::string cls((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+		input.close();
+		std::remove(cls_file.c_str());
 
-		buf = "";
-		while ((read = getline(&part, &len, fi_cls.get())) != -1) {
-			buf.append(part);
-		}
-	} else {
-		std::string cmd(getConfig()->getConfig("ssp.util", default_pathname.c_str()));
-		cmd.append(" ./out ");
-		cmd.append(mlf_file);
-		cmd.push_back(' ');
-		cmd.append(cls_file);
-		cmd.append(" 5 500");
-		if (std::system(cmd.c_str()))
-			return EXIT_FAILURE;
+		if (std::size_t invalid = __parse_cls(cls.data(), cls.size(), buf))
+			job_log->warn("[0x%X] %lu invalid lines in %s", THREAD_ID, invalid, cls_file.c_str());
+	}
 
-		// read cls and extract data
-		int first_cmp = 0;
+	return EXIT_SUCCESS;
+}
 
-		char *part = NULL;
-		size_t len = 0;
-		ssize_t read;
+/**
+ * @brief		상주 SSP 프로세스(ssp.server)로 화자 구간 분류
+ * @details		MLF를 파일로 저장하지 않고 파이프로 보내며 응답(CLS)은 VRServer::ssp()와 같은 형식으로 변환한다.
+ * @date		2026. 10. 19. 00:21:05
+ * @param[in]	mlf_data	MLF 데이터
+ * @param[out]	buf			화자 구간 (뒤에 추가)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			VRServer::ssp()
+ */
+int VRServer::ssp_request(const std::string &mlf_data, std::string &buf) {
+	if (!ssp_pool)
+		return EXIT_FAILURE;
 
-		char *str_p = NULL;
-		char ss1[64];
-		char ss2[64];
+	static thread_local std::string cls;
+	cls.clear();
+	if (ssp_pool->request(mlf_data, cls)) {
+		logger->error("[0x%X] Fail to classify by ssp.server" LOG_FMT, THREAD_ID, LOG_INFO);
+		return EXIT_FAILURE;
+	}
 
-		CLS_T line;
+	if (std::size_t invalid = __parse_cls(cls.data(), cls.size(), buf))
+		logger->warn("[0x%X] %lu invalid lines in ssp.server response" LOG_FMT, THREAD_ID, invalid, LOG_INFO);
+	return EXIT_SUCCESS;
+}
 
-		std::FILE *fp = fopen(cls_file.c_str(), "rt");
-		if (!fp) {
-			job_log->error("[0x%X] Cannot open file: %s", THREAD_ID, cls_file.c_str());
-			return EXIT_FAILURE;
-		}
-		std::shared_ptr<FILE> fi_cls(fp, fclose);
-
-		while ((read = getline(&part, &len, fi_cls.get())) != -1) {
-			str_p = strstr(part, "str= ");
-			strncpy(line.str, str_p + 5, strlen(str_p) - 5);
-			line.str[strlen(str_p) - 5] = '\0';
-			sscanf(part, "ts= %d, te= %d, [ %s %s ], str= %*s", &line.ts, &line.te, ss1, ss2);
-
-			str_p = strchr(ss1, '=');
-			strncpy(line.first.s, ss1, strlen(ss1) - strlen(str_p));
-			line.first.s[strlen(ss1) - strlen(str_p)] = '\0';
-			sscanf(str_p + 1, "%f", &line.first.value);
-
-			str_p = strchr(ss2, '=');
-			strncpy(line.second.s, ss2, strlen(ss2) - strlen(str_p));
-			line.second.s[strlen(ss2) - strlen(str_p)] = '\0';
-			sscanf(str_p + 1, "%f", &line.second.value);
-
-			if ((first_cmp = strcmp(line.first.s, "s0")) == 0) {
-				/* Nothing */
-			} else {
-				buf.append(boost::lexical_cast<std::string>(line.ts));
-				buf.push_back('\t');
-				buf.append(boost::lexical_cast<std::string>(line.te));
-				buf.push_back('\t');
-				buf.append(line.first.s);
-				buf.push_back('\n');
-			}
-		}
+/**
+ * @brief		상주 SSP 프로세스 풀 설정
+ * @details		ssp.server가 설정된 경우에만 사용하며 프로세스 수는 ssp.server_pool(기본: ssp.worker)이다.
+ * @date		2026. 10. 19. 00:25:37
+ * @see			itfact::common::CoProcessPool
+ */
+void VRServer::configureSspPool() {
+	const itfact::common::Configuration *config = getConfig();
+	if (!config->isSet("ssp.server"))
+		return;
 
-		if (part != NULL) {
-			free(part);
-			part = NULL;
-		}
+	std::vector<std::string> argv = itfact::common::splitCommand(config->getConfig("ssp.server"));
+	if (argv.empty())
+		return;
+
+	unsigned long size = config->getConfig<unsigned long>("ssp.server_pool", getTotalWorkers("ssp"));
+	ssp_pool = std::make_shared<itfact::common::CoProcessPool>(argv, size, config->getConfig("ssp.timeout", 60000L));
+	logger->info("SSP server: %s (%lu processes)", itfact::common::toString(argv).c_str(), size);
+}
+
+/**
+ * @brief		인식 결과 역색인 설정
+ * @details		index.path가 설정된 경우에만 사용한다.
+ 			index.flush_size: 메모리 segment의 최대 단어 출현 수, index.merge_factor: 병합할 segment 파일 수
+ * @date		2026. 10. 19. 03:05:12
+ * @see			TranscriptIndex
+ */
+void VRServer::configureTranscriptIndex() {
+	const itfact::common::Configuration *config = getConfig();
+	if (!config->isSet("index.path"))
+		return;
+
+	std::string index_path = config->getConfig("index.path");
+	if (!itfact::common::checkPath(index_path, true)) {
+		logger->error("Cannot create index.path: %s", index_path.c_str());
+		return;
 	}
 
-	if ((result = access(cls_file.c_str(), F_OK)) == 0) {
-		unlink(cls_file.c_str());
+	transcript_index = std::make_shared<TranscriptIndex>(index_path,
+		config->getConfig<unsigned long>("index.flush_size", 1000000UL),
+		config->getConfig<unsigned long>("index.merge_factor", 8UL), logger);
+}
+
+/**
+ * @brief		실시간 STT 채널 설정
+ * @details		realtime.max_channels: 최대 채널 수 (0: 제한 없음), realtime.spare_channels: 통화가 끝난 후 보관할 채널 수,
+ 			realtime.idle_timeout: 패킷 없이 채널을 유지하는 시간(초), realtime.channel_shards: shard 수\n
+ 			USE_REALTIME_POOL인 경우 realtime.worker 만큼의 채널을 미리 생성하며 최대 채널 수의 기본값도 realtime.worker이다.\n
+ 			realtime.endpoint가 true이면 realtime.endpoint_silence(ms) 동안 묵음이 이어질 때 발화의 최종 결과를 출력한다.
+ * @date		2026. 10. 19. 04:55:40
+ * @see			ChannelMap
+ */
+void VRServer::configureChannels() {
+	const itfact::common::Configuration *config = getConfig();
+	const unsigned long workers = getTotalWorkers("realtime");
+	if (workers == 0)
+		return;
+
+	if (config->getConfig<bool>("realtime.endpoint", false))
+		endpoint_latency = std::make_shared<LatencyHistogram>();
+
+	// 미리 생성하는 채널도 좁힌 beam을 사용하도록 채널보다 먼저 설정
+	if (config->getConfig<bool>("realtime.scheduler", false))
+		configureScheduler(workers);
+
+#ifdef USE_REALTIME_POOL
+	const unsigned long reserved = workers;
+#else
+	const unsigned long reserved = 0;
+#endif
+	const unsigned long capacity = config->getConfig<unsigned long>("realtime.max_channels", reserved);
+	const unsigned long spare = std::max(config->getConfig<unsigned long>("realtime.spare_channels", workers), reserved);
+
+	channels = std::make_shared<ChannelMap>(
+		[this](const std::size_t number) {
+			std::shared_ptr<RealtimeSTT> node;
+			create_channel(std::to_string(number), static_cast<int>(number), node);
+			return node;
+		},
+		config->getConfig<unsigned long>("realtime.channel_shards", 16UL), capacity, spare,
+		std::chrono::seconds(config->getConfig("realtime.idle_timeout", 60L)), logger);
+
+	const std::size_t created = channels->reserve(reserved);
+	logger->info("Realtime channels: %lu created, max %lu", created, capacity);
+}
+
+/**
+ * @brief		실시간 디코딩 스케줄러 설정
+ * @details		realtime.decode_slots: 동시에 디코딩하는 패킷 수, realtime.deadline(ms): 받은 후 디코딩을 시작해야 하는 시간,
+ 			realtime.degrade_after(ms): deadline이 지난 후 beam을 좁히기까지의 시간,
+ 			realtime.max_waiting: 기다릴 수 있는 패킷 수 (0: 제한 없음),
+ 			realtime.degrade_beam: 좁힌 beam의 비율 (0: beam을 바꾸지 않음)
+ * @date		2026. 10. 19. 10:02:15
+ * @param[in]	workers		realtime.worker
+ * @see			RealtimeScheduler
+ */
+void VRServer::configureScheduler(const unsigned long workers) {
+	const itfact::common::Configuration *config = getConfig();
+	const unsigned long slots = config->getConfig("realtime.decode_slots", workers);
+	const long deadline = config->getConfig("realtime.deadline", 200L);
+	scheduler = std::make_shared<RealtimeScheduler>(slots, std::chrono::milliseconds(deadline),
+		std::chrono::milliseconds(config->getConfig("realtime.degrade_after", deadline)),
+		config->getConfig("realtime.max_waiting", slots * 4));
+
+	const double ratio = config->getConfig("realtime.degrade_beam", 0.7);
+	char value[256] = "";
+	getSLaserConfig(numGPU < 2 ? master_laser : master_laser1, const_cast<char *>("GENBEAM"), value);
+	const double genbeam = std::strtod(value, NULL);
+	if (ratio > 0 && ratio < 1 && genbeam > 0) {
+		beam = value;
+		narrow_beam = std::to_string(genbeam * ratio);
 	}
+	logger->info("Realtime scheduler: %lu slots, deadline %ldms, GENBEAM %s -> %s", slots, deadline,
+				 beam.empty() ? "-" : beam.c_str(), narrow_beam.empty() ? "-" : narrow_beam.c_str());
+}
 
-	return EXIT_SUCCESS;
+/**
+ * @brief		실시간 STT 스트리밍 서버 설정
+ * @details		stream.listen: "unix:경로" 또는 "호스트:포트" (빈 문자열: 사용하지 않음),
+ 			stream.max_connections: 최대 연결 수, stream.window: 연결마다 디코딩을 기다릴 수 있는 프레임 수,
+ 			stream.max_frame: 요청 프레임 최대 크기\n
+ 			패킷은 vr_realtime 작업과 같은 채널에서 처리하므로 realtime.worker가 있어야 한다.
+ * @date		2026. 10. 19. 08:35:17
+ * @param[in]	handler		패킷 처리 함수
+ * @see			StreamServer
+ */
+void VRServer::configureStreamServer(const StreamServer::handler_t &handler) {
+	const itfact::common::Configuration *config = getConfig();
+	const std::string address = config->getConfig("stream.listen", "");
+	if (address.empty())
+		return;
+	if (!channels) {
+		logger->warn("Realtime stream requires realtime.worker");
+		return;
+	}
+
+	stream_server = std::make_shared<StreamServer>(handler, address,
+		config->getConfig<unsigned long>("stream.max_connections", 64UL),
+		config->getConfig<unsigned long>("stream.window", 16UL),
+		config->getConfig<unsigned long>("stream.max_frame", 1UL * 1024 * 1024), logger);
+	if (stream_server->start() != EXIT_SUCCESS)
+		stream_server.reset();
 }
 
 /**
@@ -1097,12 +1780,14 @@ enum WAVE_FORMAT VRServer::check_wave_format(const short *data, const size_t dat
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2017. 03. 06. 18:08:59
  * @param[in]	call_id	Call ID
+ * @param[out]	node	생성된 채널
  * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
  				Otherwise,
  				a negative error code is returned indicating what went wrong.
- * @see			VRServer::close_channel()
+ * @see			VRServer::configureChannels()
  */
-int VRServer::create_channel(const std::string &call_id, const int stt_job_count) {
+int VRServer::create_channel(const std::string &call_id, const int stt_job_count,
+							 std::shared_ptr<RealtimeSTT> &node) {
 	int rc;
 	std::size_t reset_period = getConfig()->getConfig("realtime.reset_period", RESET_PERIOD);
 
@@ -1222,39 +1907,19 @@ int VRServer::create_channel(const std::string &call_id, const int stt_job_count
 	std::shared_ptr<RealtimeSTT> realtime_stt =
 		std::make_shared<RealtimeSTT>(
 			call_id, feature_vector, frontend, child_laser/*_lP*/, mfcc_size, mini_batch, sil, job_log);
-#if 0
-	auto search = channel.find(call_id);
-	if (search != channel.end())
-		return EXIT_FAILURE;
-#endif
-	channel[call_id] = realtime_stt;
 	realtime_stt->set_reset_period(reset_period);
+	realtime_stt->set_incremental(getConfig()->getConfig<bool>("realtime.incremental", true));
+	realtime_stt->set_stable_frames(getConfig()->getConfig("realtime.stable_frames", 30UL));
+	if (!narrow_beam.empty())
+		realtime_stt->set_degrade_beam(beam, narrow_beam);
+	if (endpoint_latency)
+		realtime_stt->set_endpoint(getConfig()->getConfig("realtime.endpoint_silence", 500UL) / 10,
+								   getConfig()->getConfig("realtime.endpoint_min_speech", 200UL) / 10, endpoint_latency);
+	node = realtime_stt;
 
 	return EXIT_SUCCESS;
 }
 
-/**
- * @brief		Close channel
- * @details		채널 종료
- * @author		Kijeong Khil (kjkhil@itfact.co.kr)
- * @date		2017. 03. 09. 16:55:00
- * @param[in]	call_id	Call ID
- * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
- 				Otherwise,
- 				a negative error code is returned indicating what went wrong.
- * @see			VRServer::create_channel()
- */
-int VRServer::close_channel(const std::string &call_id) {
-	job_log->info("[0x%X] Close channel" LOG_FMT, THREAD_ID, LOG_INFO);
-
-	auto search = channel.find(call_id);
-	if (search == channel.end())
-		return EXIT_FAILURE;
-
-	channel.erase(search);
-	return EXIT_SUCCESS;
-}
-
 /**
  * @brief		STT for realtime
  * @details		Realtime STT
@@ -1265,7 +1930,9 @@ int VRServer::close_channel(const std::string &call_id) {
  * @param[in]	bufferLen	녹취 데이터 길이 
  * @param[in]	is_last		마지막 패킷 여부 
  * @param[out]	result		STT 결과
+ * @param[in]	arrival		패킷을 받은 시각 (realtime.scheduler, 기본값이면 지금)
  * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				RT_SHED is returned if the scheduler did not admit the call.\n
  				Otherwise,
  				a negative error code is returned indicating what went wrong.
  */
@@ -1274,44 +1941,148 @@ int VRServer::stt(
 	const short *buffer,
 	const std::size_t bufferLen,
 	const char state,
-	std::string &result
+	std::string &result,
+	const std::chrono::steady_clock::time_point arrival
 ) {
-#ifdef USE_REALTIME_POOL
-	std::map<std::string, std::shared_ptr<RealtimeSTT>>::iterator iter;
-	std::shared_ptr<RealtimeSTT> node = nullptr;
-	int rc = 0;
-
-	{
-		std::lock_guard<std::mutex> g(m_mxChannel);
-		for(iter = channel.begin(); iter != channel.end(); iter++) {
-			node = iter->second;
-			if (!node->getCurrState()) {
-				node->setCurrState(1);
-				break;
-			}
-		}
-	}
+	itfact::common::ScopedAffinity affinity(getTopology()->getCpuSet("omp"));
+	if (omp_threads)
+		omp_set_num_threads(static_cast<int>(omp_threads));
 
-	if ( node ) {
-		rc = node->stt(buffer, bufferLen, result);
-		node->setCurrState(0);
+	if (!channels)
+		return EXIT_FAILURE;
+
+	// 마감 시각 순서로 디코딩 (채널은 차례가 온 후 사용)
+	int level = RT_DEGRADE_NONE;
+	if (scheduler && scheduler->acquire(call_id, arrival, bufferLen, state, level) != EXIT_SUCCESS) {
+		job_log->warn("[0x%X] Shed call %s" LOG_FMT, THREAD_ID, call_id.c_str(), LOG_INFO);
+		return RT_SHED;
 	}
-#else
-	auto search = channel.find(call_id);
-	if (search == channel.end()) {
-		if ((state == 1) || (create_channel(call_id, channel.size()) != EXIT_SUCCESS)) {
-			job_log->error("[0x%X] Cannot connect channel" LOG_FMT, THREAD_ID, LOG_INFO);
-			return EXIT_FAILURE;
-		}
+
+	// 통화가 끝나거나 정리될 때까지 같은 채널을 사용하여 디코딩 상태를 유지
+	std::shared_ptr<RealtimeSTT> node = channels->acquire(call_id);
+	if (!node) {
+		job_log->warn("[0x%X] No idle channel for call %s" LOG_FMT, THREAD_ID, call_id.c_str(), LOG_INFO);
+		if (scheduler)
+			scheduler->release();
+		return EXIT_FAILURE;
 	}
 
-	auto node = channel[call_id];
+	// 같은 Call ID로 새 통화가 시작된 경우
+	if (state == 0)
+		node->reset();
+
+	node->set_degrade(level);
 	int rc = node->stt(buffer, bufferLen, result);
+	if (state == 2 && rc == EXIT_SUCCESS)
+		rc = node->free_buffer(result);
+	else if (rc != EXIT_SUCCESS)
+		node->reset();
+
+	channels->release(call_id, node, state == 2);
+	if (scheduler)
+		scheduler->release();
+	return rc;
+}
 
-	if (state == 2) {
-		// rc = node->free_buffer(result);
-		close_channel(call_id);
+/**
+ * @brief		패킷 단위 실시간 STT
+ * @details		v1 패킷은 바로 디코딩한다. v2 패킷은 통화의 지터 버퍼에 넣고, 다른 작업자가 디코딩하고 있지 않으면
+ 			순서대로 꺼낼 수 있는 패킷을 모두 디코딩한다. LAST 패킷은 앞선 작업자를 기다렸다가 최종 결과를 가져간다.
+ * @date		2026. 10. 19. 07:45:10
+ * @param[in]	packet		패킷
+ * @param[out]	results		디코딩한 패킷별 (상태, STT 결과). 다른 작업자가 디코딩하거나 늦은 패킷이면 비어 있음
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise,
+ 				a negative error code is returned indicating what went wrong.
+ * @see			JitterBuffer
+ */
+int VRServer::stt(const rt_packet_t &packet, std::vector<std::pair<char, std::string>> &results) {
+	if (packet.version < 2) {
+		results.push_back(std::make_pair(packet.state, std::string()));
+		const int rc = stt(packet.call_id, packet.pcm, packet.samples, packet.state, results.back().second,
+						   packet.arrival);
+		return rc == RT_SHED ? EXIT_FAILURE : rc;
 	}
-#endif
-	return rc;
+
+	std::shared_ptr<JitterBuffer> jitter = getJitterBuffer(packet.call_id);
+	const bool final_owner = packet.state == 2;
+	if (!jitter->push(packet) || !jitter->begin(final_owner))
+		return EXIT_SUCCESS;
+
+	// 실패한 후에도 꺼내기를 끝내기 위해 남은 패킷은 버림 (스케줄러가 받지 않은 통화도 실패)
+	JitterBuffer::packet_t item;
+	int rc = EXIT_SUCCESS;
+	while (jitter->pop(final_owner, item)) {
+		if (rc != EXIT_SUCCESS)
+			continue;
+		results.push_back(std::make_pair(item.state, std::string()));
+		rc = stt(packet.call_id, item.pcm.data(), item.pcm.size(), item.state, results.back().second, item.arrival);
+	}
+	return rc == RT_SHED ? EXIT_FAILURE : rc;
+}
+
+/**
+ * @brief		통화의 지터 버퍼
+ * @details		realtime.jitter_depth: 빠진 패킷을 기다리는 동안 쌓아 둘 최대 패킷 수\n
+ 			새 통화가 생길 때 realtime.idle_timeout(초) 동안 패킷이 없는 통화의 지터 버퍼를 정리한다.
+ * @date		2026. 10. 19. 07:41:36
+ */
+std::shared_ptr<JitterBuffer> VRServer::getJitterBuffer(const std::string &call_id) {
+	std::lock_guard<std::mutex> guard(m_mxJitter);
+	auto search = jitters.find(call_id);
+	if (search != jitters.end())
+		return search->second;
+
+	const auto now = std::chrono::steady_clock::now();
+	const std::chrono::seconds timeout(getConfig()->getConfig("realtime.idle_timeout", 60L));
+	for (auto iter = jitters.begin(); iter != jitters.end();) {
+		if (now - iter->second->getLastUsed() > timeout)
+			iter = jitters.erase(iter);
+		else
+			++iter;
+	}
+
+	std::shared_ptr<JitterBuffer> jitter =
+		std::make_shared<JitterBuffer>(getConfig()->getConfig("realtime.jitter_depth", 5UL), &jitter_stats);
+	jitters[call_id] = jitter;
+	return jitter;
+}
+
+/**
+ * @brief		서버 상태
+ * @details		"항목\t값" 형식의 줄로 구성된다.
+ * @date		2026. 10. 18. 14:07:33
+ * @param[out]	result		상태 정보
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise,
+ 				a negative error code is returned indicating what went wrong.
+ */
+int VRServer::stats(std::string &result) {
+	const itfact::common::Topology *topology = getTopology();
+
+	result.append("server_name\t").append(server_name).push_back('\n');
+	result.append("topology.cpus\t").append(std::to_string(topology->getTotal())).push_back('\n');
+	result.append("topology\t").append(topology->empty() ? "disabled" : topology->toString()).push_back('\n');
+	result.append("topology.omp_threads\t").append(std::to_string(omp_threads)).push_back('\n');
+	result.append("fingerprint\t").append(fingerprint).push_back('\n');
+	if (result_cache)
+		result_cache->stats(result);
+	if (postproc_cache)
+		postproc_cache->stats(result);
+	if (ssp_pool)
+		ssp_pool->stats("ssp.server", result);
+	if (transcript_index)
+		transcript_index->stats(result);
+	if (channels) {
+		channels->stats(result);
+		jitter_stats.stats(result);
+	}
+	if (endpoint_latency)
+		endpoint_latency->stats("realtime.endpoint", result);
+	if (stream_server)
+		stream_server->stats(result);
+	if (scheduler)
+		scheduler->stats(result);
+
+	return EXIT_SUCCESS;
 }
@@ -10,14 +10,23 @@
 #ifndef __ITFACT_VR_SERVER_H__
 #define __ITFACT_VR_SERVER_H__
 
+#include <atomic>
 #include <chrono>
 #include "worker.hpp"
 #include "frontend_api.h"
 #include "Laser.h"
+#include "analytics.hpp"
+#include "channel_map.hpp"
+#include "jitter_buffer.hpp"
+#include "postproc_cache.hpp"
+#include "process.hpp"
+#include "result_cache.hpp"
+#include "result_parser.hpp"
+#include "rt_scheduler.hpp"
+#include "stream_server.hpp"
+#include "transcript_index.hpp"
 
-#ifdef USE_REALTIME_POOL
 #include <mutex>
-#endif
 
 using namespace itfact::worker;
 
@@ -36,6 +45,7 @@ namespace itfact {
 				UNKNOWN_FORMAT	///< �� �� ����
 			};
 			class RealtimeSTT;
+			class RealtimeUnsegment;
 
 			static const unsigned long MAX_MINIBATCH = 1024;
 			//static const unsigned long DEFAULT_ENGINE_CORE = 10;
@@ -47,6 +57,14 @@ namespace itfact {
 			//static const std::size_t RESET_PERIOD = 2000000; // 2 GiB
 			static const std::size_t RESET_PERIOD = 500000; //  
 
+			/// 작업별 STT 옵션
+			typedef struct {
+				std::string checkpoint;		///< 체크포인트 파일 (빈 문자열: 사용하지 않음)
+				std::string feature_file;	///< 특징 벡터 저장 파일 (빈 문자열: 사용하지 않음)
+				bool feature_compress;		///< 특징 벡터 8bit 압축 여부
+				SpeechAnalytics *analytics;	///< FrontEnd에 넣은 PCM의 음성 구간 분석 (NULL: 사용하지 않음)
+			} stt_option_t;
+
 			int getFinalResult(Laser *slaserP, const std::size_t index, std::size_t &last_position,
 				const std::size_t feature_dim, const std::size_t mfcc_size, float * const sil,
 				std::string &buffer);
@@ -54,6 +72,7 @@ namespace itfact {
 				std::size_t &skip_position, const std::size_t last_position, std::string &buffer,
 				const float minimum_confidence = 0,
 				const std::size_t end_position = SIZE_MAX);
+			void postProcess(PostProcCache *cache, const std::string &chunk, char *output, std::string &result);
 
 			/**
 			 * @brief	VR ���
@@ -69,7 +88,15 @@ namespace itfact {
 				Laser *master_laser2 = NULL;
 				float *sil = NULL;
 				float minimum_confidence = 0;
-				std::map<std::string, std::shared_ptr<RealtimeSTT>> channel;
+				std::shared_ptr<ChannelMap> channels;	// 통화별 실시간 STT 채널
+				std::shared_ptr<LatencyHistogram> endpoint_latency;	// 발화 끝 검출 지연 (realtime.endpoint)
+				std::map<std::string, std::shared_ptr<JitterBuffer>> jitters;	// 통화별 지터 버퍼 (v2 패킷)
+				std::mutex m_mxJitter;
+				JitterStats jitter_stats;
+				std::shared_ptr<RealtimeScheduler> scheduler;	// 실시간 디코딩 스케줄러 (realtime.scheduler)
+				std::string beam;				// 채널의 기본 GENBEAM
+				std::string narrow_beam;		// 늦은 패킷의 GENBEAM (빈 문자열: beam을 좁히지 않음)
+				std::shared_ptr<StreamServer> stream_server;	// 실시간 STT 스트리밍 연결 (stream.listen)
 
 				// ----------
 				std::size_t mfcc_size = 600;;
@@ -80,6 +107,12 @@ namespace itfact {
 				long idGPU = 0;					// GPU ID
 				int numGPU = 1;					// GPU ��
 				long stt_job_count = 1;
+				unsigned long omp_threads = 0;	// 디코딩 스레드별 OpenMP 스레드 수 (0: 변경하지 않음)
+				std::shared_ptr<ResultCache> result_cache;	// STT 결과 캐시
+				std::shared_ptr<PostProcCache> postproc_cache;	// SPLPostProc 결과 캐시
+				std::shared_ptr<itfact::common::CoProcessPool> ssp_pool;	// 상주 SSP 프로세스 (ssp.server)
+				std::shared_ptr<TranscriptIndex> transcript_index;	// 인식 결과 역색인 (index.path)
+				std::string fingerprint;		// 모델 및 설정 fingerprint
 
 				std::size_t feature_dim;
 
@@ -90,9 +123,6 @@ namespace itfact {
 				std::string dnn_file;
 				std::string prior_file;
 				std::string norm_file;				
-#ifdef USE_REALTIME_POOL
-				mutable std::mutex m_mxChannel;
-#endif
 			public:
 				// Server Name
 				std::string server_name;
@@ -102,27 +132,50 @@ namespace itfact {
 				VRServer(const int argc, const char *argv[]) : WorkerDaemon(argc, argv) {};
 				~VRServer();
 				virtual int initialize() override;
-				int stt(const short *buffer, const std::size_t bufferLen, long stt_thread_num, std::string &result);
+				int stt(const short *buffer, const std::size_t bufferLen, long stt_thread_num, std::string &result,
+						const stt_option_t *option = NULL);
+				int stt_feature(const std::string &pathname, std::string &result, std::size_t &samples);
+				int save_feature(const short *buffer, const std::size_t bufferLen, const std::string &pathname,
+								 const bool compress);
 				int unsegment(const std::string &data, std::string &result);
+				int unsegment_realtime(const std::string &cell_data, std::string &result);
 				int unsegment_with_time(const std::string &mlf_file, const std::string &unseg_file, int pause);
-				int ssp(const std::string &mlf_file, std::string &buf);				
+				int unsegment_with_time(const char *mlf, const std::size_t size, std::string &text, int pause);
+				int ssp(const std::string &mlf_file, std::string &buf);
+				int ssp_request(const std::string &mlf_data, std::string &buf);				
 				static enum WAVE_FORMAT check_wave_format(const short *data, const size_t data_size);
+				int stats(std::string &result);
+				ResultCache *getResultCache() {return result_cache.get();};
+				bool hasSspServer() const {return static_cast<bool>(ssp_pool);};
+				TranscriptIndex *getTranscriptIndex() {return transcript_index.get();};
+				const std::string &getFingerprint() const {return fingerprint;};
 
 				bool init_sftp(std::string _host, std::string _port, std::string _id, std::string _passwd, bool bEncrypt);
 				bool init_ftps(std::string _host, std::string _port, std::string _id, std::string _passwd, bool bEncrypt);
 
 				// For Real-time
 				int stt(const std::string &call_id, const short *buffer, const std::size_t bufferLen,
-						const char state, std::string &result);
+						const char state, std::string &result,
+						const std::chrono::steady_clock::time_point arrival = std::chrono::steady_clock::time_point());
+				int stt(const rt_packet_t &packet, std::vector<std::pair<char, std::string>> &results);
 
 			private:
 				//int monitoring(std::shared_ptr<std::string> path);
+				void configureTopology();
 				bool loadLaserModule();
+				void configureResultCache();
+				void configureSspPool();
+				void configureTranscriptIndex();
+				void configureChannels();
+				void configureScheduler(const unsigned long workers);
+				void configureStreamServer(const StreamServer::handler_t &handler);
+				Laser *createChildLaser();
 				void unloadLaserModule();
 
 				// For Real-time
-				int create_channel(const std::string &call_id, const int stt_job_count);
-				int close_channel(const std::string &call_id);
+				int create_channel(const std::string &call_id, const int stt_job_count,
+								   std::shared_ptr<RealtimeSTT> &node);
+				std::shared_ptr<JitterBuffer> getJitterBuffer(const std::string &call_id);
 			};
 
 			class RealtimeSTT
@@ -140,7 +193,18 @@ namespace itfact {
 				std::size_t reset_period;
 				std::size_t index = 0;
 				std::size_t skip_position = 0;
-				//std::size_t last_position = 0;
+				std::size_t last_position = 0;
+				bool incremental = true;			// 패킷 사이에 디코딩 상태 유지 (false: 패킷마다 처음부터 디코딩)
+				std::size_t stable_frames = 30;		// 중간 결과에서 디코딩 위치와 이만큼 떨어진 단어만 확정
+				std::vector<float> pending;			// mini batch를 채우지 못한 특징 벡터
+				std::size_t pending_frames = 0;
+				std::unique_ptr<Endpointer> endpointer;	// 발화 끝 검출 (NULL: LAST 패킷에서만 최종 결과)
+				std::shared_ptr<LatencyHistogram> endpoint_latency;
+				std::vector<std::size_t> endpoints;
+				int degrade = 0;					// RT_DEGRADE
+				std::string beam;					// 기본 GENBEAM
+				std::string narrow_beam;			// RT_DEGRADE_BEAM의 GENBEAM (빈 문자열: 바꾸지 않음)
+				bool narrowed = false;
 
 				// ----------
 				std::size_t mfcc_size = 600;
@@ -149,7 +213,7 @@ namespace itfact {
 				std::size_t feature_dim;
 				float *sil = NULL;
 
-				volatile uint8_t m_CurrState; // 0: stanby, 1: working
+				std::atomic<uint8_t> m_CurrState; // 0: stanby, 1: working
 
 			public:
 				RealtimeSTT(std::string callid,
@@ -164,14 +228,47 @@ namespace itfact {
 				~RealtimeSTT();
 
 				void set_reset_period(const std::size_t period);
+				void set_incremental(const bool enable) { incremental = enable; }
+				void set_stable_frames(const std::size_t frames) { stable_frames = frames; }
+				void set_endpoint(const std::size_t trailing, const std::size_t min_speech,
+								  const std::shared_ptr<LatencyHistogram> &latency);
+				void set_degrade_beam(const std::string &normal, const std::string &narrow);
+				void set_degrade(const int level);
 				int stt(const short *buffer, const std::size_t buffer_len, std::string &result);
 				int free_buffer(std::string &result);
+				void reset();
 
 				uint8_t getCurrState() { return m_CurrState; }
 				void setCurrState(uint8_t state) { m_CurrState=state; }
 
 			private:
 				RealtimeSTT();
+				int stt_packet(const short *buffer, const std::size_t buffer_len, std::string &result);
+				int step(const std::size_t nf, std::string &result);
+				int endpoint(const std::size_t end, std::string &result);
+				int finalize(std::string &result);
+				int final_result(std::string &result);
+			};
+
+			/**
+			 * @brief	실시간 패킷 후처리 버퍼
+			 * @details	패킷마다 새로 확정된 단어만 SPLPostProc으로 처리한다.\n
+			 			파싱 및 SPLPostProc 버퍼는 작업 스레드별로 재사용한다. (VRServer::unsegment_realtime())
+			 */
+			class RealtimeUnsegment
+			{
+			private:
+				std::vector<result_word_t> words;	// 패킷의 단어
+				std::string chunk;					// SPLPostProc 입력
+				std::vector<char> output;			// SPLPostProc 출력
+
+			public:
+				RealtimeUnsegment();
+
+				int append(PostProcCache *cache, const std::string &cell_data, std::string &result);
+
+			private:
+				void flush(PostProcCache *cache, std::string &result);
 			};
 		}
 	}
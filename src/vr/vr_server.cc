@@ -8,7 +8,10 @@
  */
 #include <cerrno>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <unordered_map>
 #include <time.h>
 #include <unistd.h>
 #include <arpa/inet.h>
@@ -18,8 +21,13 @@
 #include <boost/lexical_cast.hpp>
 
 #include "ETRIPP.h"
+#include "hash.hpp"
+#include "process.hpp"
+#include "result_codec.hpp"
+#include "task_pool.hpp"
 #include "vr.hpp"
 #include "restapi.hpp"
+#include "rt_packet.hpp"
 
 #include "chilkat/CkGlobal.h"
 #include "chilkat/CkCrypt2.h"
@@ -34,12 +42,21 @@ using namespace itfact::vr::node;
 
 static log4cpp::Category *job_log = NULL;
 static std::string tmp_path;
+static std::shared_ptr<itfact::common::TaskPool> unsegment_pool;	// vr_text_batch, vr_text_only_batch 작업용
+static std::shared_ptr<itfact::common::TaskPool> realtime_pool;	// vr_realtime_mux 작업용
 
 static gearman_return_t job_stt(gearman_job_st *, void *);
 static gearman_return_t job_unsegment(gearman_job_st *, void *);
 static gearman_return_t job_unsegment_with_time(gearman_job_st *, void *);
+static gearman_return_t job_unsegment_batch(gearman_job_st *, void *);
+static gearman_return_t job_unsegment_only_batch(gearman_job_st *, void *);
 static gearman_return_t job_ssp(gearman_job_st *job, void *context);
 static gearman_return_t job_rt_stt(gearman_job_st *job, void *context);
+static gearman_return_t job_rt_mux(gearman_job_st *job, void *context);
+static int __rt_stt(VRServer *server, const char *job_name, const rt_packet_t &packet, std::string &text);
+static gearman_return_t job_stats(gearman_job_st *job, void *context);
+static gearman_return_t job_stt_feature(gearman_job_st *job, void *context);
+static gearman_return_t job_search(gearman_job_st *job, void *context);
 
 static CkSFtp sftp;
 static CkFtp2 ftp;
@@ -104,6 +121,7 @@ int main(const int argc, char const *argv[]) {
 }
 
 VRServer::~VRServer() {
+	channels.reset();
 	if (master_laser)
 		unloadLaserModule();
 }
@@ -337,6 +355,16 @@ int VRServer::initialize() {
 		tmp_path.push_back('/');
 	itfact::common::checkPath(tmp_path, true);
 
+	if (config->isSet("stt.checkpoint_path")) {
+		itfact::common::checkPath(config->getConfig("stt.checkpoint_path"), true);
+		job_log->debug("stt.checkpoint_path: %s", config->getConfig("stt.checkpoint_path").c_str());
+	}
+
+	if (config->isSet("stt.feature_path")) {
+		itfact::common::checkPath(config->getConfig("stt.feature_path"), true);
+		job_log->debug("stt.feature_path: %s", config->getConfig("stt.feature_path").c_str());
+	}
+
 	job_log->debug("stt.am_filename: %s", am_file.c_str());
 	job_log->debug("stt.fsm_filename: %s", fsm_file.c_str());
 	job_log->debug("stt.sym_filename: %s", sym_file.c_str());
@@ -398,39 +426,62 @@ int VRServer::initialize() {
 
 	//FIXME: License 체크 
 
+	// CPU 배치 
+	if (config->getConfig<bool>("topology.enable", false))
+		configureTopology();
+
 	// module 초기화 
 	if (!loadLaserModule()) {
 		job_log->fatal("Cannot load LASER module");
 		return EXIT_FAILURE;
 	}
+	configureResultCache();
+	configureSspPool();
+	configureTranscriptIndex();
+	configureChannels();
+	configureStreamServer([this](const rt_packet_t &packet, std::string &text) {
+		return __rt_stt(this, "STREAM", packet, text);
+	});
 
 	// Controller 실행 
 	//RestApi api(config, job_log);
 	//api.start();
 
 	unsigned long useg_worker = getTotalWorkers("unsegment");
+	if (useg_worker)
+		unsegment_pool = std::make_shared<itfact::common::TaskPool>(
+			config->getConfig("unsegment.batch_threads", useg_worker));
+	unsigned long mux_worker = getTotalWorkers("realtime") ? config->getConfig("realtime.mux_worker", 0UL) : 0;
+	if (mux_worker)
+		realtime_pool = std::make_shared<itfact::common::TaskPool>(
+			config->getConfig("realtime.mux_threads", getTotalWorkers("realtime")));
 
 	job_log->info("Connect to Master server(%s:%d)", config->getHost().c_str(), config->getPort());
-	run("vr_stt", this, getTotalWorkers("stt"), job_stt);
+	// vr_stt_text는 후처리(SPLPostProc) 초기화가 필요
+	std::vector<std::string> stt_aliases = {"vr_stt_bin", "vr_stt_binz"};
+	if (useg_worker > 0)
+		stt_aliases.push_back("vr_stt_text");
+	if (config->isSet("stt.feature_path"))
+		stt_aliases.push_back("vr_stt_feature");
+	run("vr_stt", this, getTotalWorkers("stt"), job_stt, stt_aliases);
 	run("vr_text_only", this, useg_worker, job_unsegment);
+	run("vr_text_only_batch", this, useg_worker, job_unsegment_only_batch);
 	run("vr_text", this, useg_worker, job_unsegment_with_time);
+	run("vr_text_batch", this, useg_worker, job_unsegment_batch);
 	run("vr_ssp", this, getTotalWorkers("ssp"), job_ssp);
 	run("vr_realtime", this, getTotalWorkers("realtime"), job_rt_stt);
-
-#ifdef USE_REALTIME_POOL
-	for(int i=0; i<getTotalWorkers("realtime"); i++) {
-		create_channel(std::to_string(i), channel.size());
-	}
-#endif
+	run("vr_realtime_mux", this, mux_worker, job_rt_mux);
+	run(std::string("vr_stats_") + server_name, this, 1, job_stats);
+	if (getTranscriptIndex())
+		run(std::string("vr_search_") + server_name, this, config->getConfig("index.worker", 1), job_search);
 
 	job_log->info("Done");
 	join();
+	realtime_pool.reset();
 
-#ifdef USE_REALTIME_POOL
-	for(int i=0; i<getTotalWorkers("realtime"); i++) {
-		close_channel(std::to_string(i));
-	}
-#endif
+	// 채널의 Laser는 모듈보다 먼저 해제
+	stream_server.reset();
+	channels.reset();
 
 	// module 종료 
 	job_log->info("Release server");
@@ -608,21 +659,140 @@ static inline bool __load_file(const std::string &output_file, std::vector<short
 	return true;
 }
 
+/**
+ * @brief		녹취 데이터 해시
+ * @details		재요청된 작업은 Gearman job handle이 바뀌므로 녹취 데이터의 해시와 길이로 작업을 구분한다.
+ * @date		2026. 10. 18. 16:34:50
+ * @param[in]	server	VR 인스턴스
+ * @param[in]	data	녹취 데이터
+ * @param[in]	size	녹취 데이터 길이
+ * @return		체크포인트, 특징 벡터 저장, 결과 캐시를 사용하지 않는 경우 빈 문자열
+ * @see			__checkpoint_name(), __feature_name(), __job_stt()
+ */
+static inline std::string __digest(VRServer *server, const short *data, size_t size) {
+	if (!server->getConfig()->isSet("stt.checkpoint_path") && !server->getConfig()->isSet("stt.feature_path") &&
+		!server->getResultCache())
+		return std::string();
+
+	std::string digest = itfact::common::toHex(itfact::common::hash128(data, size * sizeof(short)));
+	digest.push_back('_');
+	digest.append(std::to_string(size));
+	return digest;
+}
+
+/**
+ * @brief		체크포인트 파일명
+ * @date		2026. 10. 18. 15:02:24
+ * @param[in]	server	VR 인스턴스
+ * @param[in]	digest	녹취 데이터 해시
+ * @param[in]	suffix	채널 구분자
+ * @return		stt.checkpoint_path가 설정되지 않은 경우 빈 문자열
+ * @see			VRServer::stt()
+ */
+static inline std::string __checkpoint_name(VRServer *server, const std::string &digest, const char *suffix) {
+	if (digest.empty() || !server->getConfig()->isSet("stt.checkpoint_path"))
+		return std::string();
+
+	std::string pathname = server->getConfig()->getConfig("stt.checkpoint_path");
+	if (pathname.at(pathname.size() - 1) != '/')
+		pathname.push_back('/');
+	pathname.append(digest).append(suffix).append(".ckpt");
+	return pathname;
+}
+
+/**
+ * @brief		특징 벡터 파일명
+ * @date		2026. 10. 18. 18:40:09
+ * @param[in]	server	VR 인스턴스
+ * @param[in]	digest	녹취 데이터 해시
+ * @param[in]	suffix	채널 구분자
+ * @return		stt.feature_path가 설정되지 않은 경우 빈 문자열
+ * @see			VRServer::stt(), job_stt_feature()
+ */
+static inline std::string __feature_name(VRServer *server, const std::string &digest, const char *suffix) {
+	if (digest.empty() || !server->getConfig()->isSet("stt.feature_path"))
+		return std::string();
+
+	std::string pathname = server->getConfig()->getConfig("stt.feature_path");
+	if (pathname.at(pathname.size() - 1) != '/')
+		pathname.push_back('/');
+	pathname.append(digest).append(suffix).append(".feat");
+	return pathname;
+}
+
+/**
+ * @brief		특징 벡터 파일명을 응답 헤더의 크기 뒤에 추가
+ * @details		"\tfeature=<파일명>" 형식이며 2채널은 채널별 파일명을 ','로 구분한다.
+ 			파일명은 stt.feature_path 기준이므로 그대로 vr_stt_feature 작업에 사용할 수 있다.
+ * @date		2026. 10. 19. 10:38:17
+ * @param[out]	header		응답 헤더 (뒤에 추가)
+ * @param[in]	features	채널별 특징 벡터 파일 (하나라도 저장되지 않았으면 추가하지 않음)
+ * @see			__feature_name(), job_stt_feature()
+ */
+static inline void __append_feature(std::string &header, const std::vector<std::string> &features) {
+	std::string names;
+	for (auto &&pathname : features) {
+		if (pathname.empty() || access(pathname.c_str(), F_OK) != 0)
+			return;
+		if (!names.empty())
+			names.push_back(',');
+		names.append(pathname.substr(pathname.rfind('/') + 1));
+	}
+	if (!names.empty())
+		header.append("\tfeature=").append(names);
+}
+
 /**
  * @brief		STT 수행
+ * @details		결과 캐시를 사용하는 경우 같은 녹취의 결과가 있으면 디코딩하지 않으며,
+ 			같은 녹취가 동시에 요청되면 하나만 디코딩한다.
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2016. 10. 14. 17:53:49
  * @param[in]	server	 VR 인스턴스 
+ * @param[in]	digest		녹취 데이터 해시
+ * @param[in]	checkpoint	체크포인트 파일
+ * @param[in]	feature		특징 벡터 저장 파일
+ * @param[out]	analytics	통화 분석 (NULL: 사용하지 않음)
  * @return		Upon successful completion, a TRUE is returned.\n
  				Otherwise, a FALSE is returned.
  * @see			job_stt()
  */
-static inline bool __job_stt(VRServer *server, short *data, size_t size, long stt_thread_num, std::string &cell_data) {
+static inline bool __job_stt(VRServer *server, short *data, size_t size, long stt_thread_num, std::string &cell_data,
+							 const std::string &digest = "", const std::string &checkpoint = "",
+							 const std::string &feature = "", SpeechAnalytics *analytics = NULL) {
 	try {
-		int rc = server->stt(data, size, stt_thread_num, cell_data);
+		stt_option_t option;
+		option.checkpoint = checkpoint;
+		option.feature_file = feature;
+		option.feature_compress = server->getConfig()->getConfig<bool>("stt.feature_compress", false);
+		option.analytics = analytics;
+
+		int rc;
+		bool decoded = true;
+		ResultCache *cache = server->getResultCache();
+		if (cache && !digest.empty()) {
+			std::string key(digest);
+			key.push_back('_');
+			key.append(server->getFingerprint());
+			decoded = false;
+			rc = cache->get(key, cell_data, [&](std::string &result) {
+				decoded = true;
+				return server->stt(data, size, stt_thread_num, result, &option);
+			});
+		} else {
+			rc = server->stt(data, size, stt_thread_num, cell_data, &option);
+		}
 		if (rc)
 			return false;
 
+		// 캐시된 결과는 디코딩하지 않으므로 특징 벡터가 없으면 따로 저장
+		if (!decoded && !feature.empty() && access(feature.c_str(), F_OK) != 0)
+			server->save_feature(data, size, feature, option.feature_compress);
+
+		// 캐시된 결과나 체크포인트로 디코딩하지 않은 부분
+		if (analytics && analytics->getSamples() < size)
+			analytics->append(data + analytics->getSamples(), size - analytics->getSamples());
+
 		return true;
 	} catch (std::exception &e) {
 		return false;
@@ -631,6 +801,191 @@ static inline bool __job_stt(VRServer *server, short *data, size_t size, long st
 	}
 }
 
+/**
+ * @brief		통화 분석 사용 여부 (stt.analytics)
+ */
+static inline bool __use_analytics(VRServer *server) {
+	return server->getConfig()->getConfig<bool>("stt.analytics", false);
+}
+
+/**
+ * @brief		바이너리 응답 요청 여부
+ * @details		vr_stt_bin, vr_stt_binz는 vr_stt와 같은 워커에 등록되며 응답 형식만 다르다.
+ * @date		2026. 10. 18. 20:48:12
+ * @param[out]	compress	LZ4 압축 여부 (vr_stt_binz)
+ * @see			itfact::common::encodeResult()
+ */
+static inline bool __binary_result(gearman_job_st *job, bool &compress) {
+	const char *name = gearman_job_function_name(job);
+	compress = name && std::strcmp(name, "vr_stt_binz") == 0;
+	return compress || (name && std::strcmp(name, "vr_stt_bin") == 0);
+}
+
+/**
+ * @brief		STT와 후처리를 함께 요청했는지 확인 (vr_stt_text)
+ * @date		2026. 10. 19. 00:41:22
+ */
+static inline bool __text_result(gearman_job_st *job) {
+	const char *name = gearman_job_function_name(job);
+	return name && std::strcmp(name, "vr_stt_text") == 0;
+}
+
+/**
+ * @brief		저장된 특징 벡터로 다시 디코딩을 요청했는지 확인 (vr_stt_feature)
+ * @date		2026. 10. 19. 10:41:56
+ * @see			job_stt_feature()
+ */
+static inline bool __feature_request(gearman_job_st *job) {
+	const char *name = gearman_job_function_name(job);
+	return name && std::strcmp(name, "vr_stt_feature") == 0;
+}
+
+/**
+ * @brief		STT 결과에 후처리 텍스트를 붙인 응답 생성 (vr_stt_text)
+ * @details		응답: SUCCESS\n<서버>\n<크기>\n<텍스트 크기>\n<텍스트><셀 데이터>
+ 			텍스트는 vr_text_only와 같은 결과이며 2채널은 vr_stt와 같이 채널별 결과를 "||"로 연결한다.
+ * @date		2026. 10. 19. 00:44:09
+ * @param[in]	header		응답 헤더 (SUCCESS\n<서버>\n<크기>)
+ * @param[in]	channels	채널별 셀 데이터
+ * @param[out]	response	응답
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ * @see			job_unsegment()
+ */
+static inline int __attach_text(VRServer *server, const std::string &header,
+								const std::vector<std::pair<const char *, size_t>> &channels,
+								std::string &response) {
+	std::string text;
+	std::string cells;
+	for (size_t i = 0; i < channels.size(); ++i) {
+		if (i > 0) {
+			text.append("||");
+			cells.append("||");
+		}
+		std::string cell_data(channels[i].first, channels[i].second);
+		if (server->unsegment(cell_data, text))
+			return EXIT_FAILURE;
+		cells.append(cell_data);
+	}
+
+	response = header;
+	response.push_back('\n');
+	response.append(std::to_string(text.size()));
+	response.push_back('\n');
+	response.append(text);
+	response.append(cells);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		화자분리 설정 시 결과 앞에 붙는 JSON
+ */
+static inline std::string __spk_header(VRServer *server) {
+	std::string header("{\"spk_flag\":\"true\",\"spk_node\":\"");
+	if (server->getConfig()->isSet("spk.worker_name")) {
+		header.append(server->getConfig()->getConfig("spk.worker_name"));
+	}
+	else {
+		header.append("vr_spk");
+	}
+	header.append("\"}\n");
+	return header;
+}
+
+/**
+ * @brief		바이너리 응답 생성
+ * @date		2026. 10. 18. 20:51:40
+ * @param[in]	server		VR 인스턴스
+ * @param[in]	size		녹취 데이터 크기 (bytes)
+ * @param[in]	spk_node	화자분리 워커
+ * @param[in]	metrics		텍스트 응답 헤더의 크기 뒤에 붙는 "\tkey=value" 항목 (통화 분석 지표, feature)
+ * @param[in]	channels	채널별 STT 결과 (위치, 길이)
+ * @param[in]	compress	LZ4 압축 여부
+ * @param[out]	response	응답
+ */
+static inline void __encode_result(VRServer *server, const size_t size, const std::string &spk_node,
+								   const std::string &metrics,
+								   std::initializer_list<std::pair<const char *, size_t>> channels,
+								   const bool compress, std::string &response) {
+	itfact::common::result_data_t result;
+	result.server = server->server_name;
+	result.size = size;
+	result.spk_node = spk_node;
+
+	std::vector<std::string> fields;
+	boost::split(fields, metrics, boost::is_any_of("\t"), boost::token_compress_on);
+	for (auto &&field : fields) {
+		const std::size_t pos = field.find('=');
+		if (pos != std::string::npos)
+			result.fields.push_back(std::make_pair(field.substr(0, pos), field.substr(pos + 1)));
+	}
+	for (auto &&channel : channels) {
+		result.channels.push_back(std::vector<itfact::common::result_cell_t>());
+		itfact::common::parseCells(channel.first, channel.second, result.channels.back());
+	}
+	itfact::common::encodeResult(result, response, compress);
+}
+
+/**
+ * @brief		색인에 사용할 통화 ID
+ * @details		녹취 파일 경로(workload)를 사용하며, 녹취 데이터를 직접 받은 경우 데이터의 해시를 사용한다.
+ * @date		2026. 10. 19. 03:12:40
+ */
+static inline std::string __call_id(const char *workload, const size_t workload_size, enum PROTOCOL protocol) {
+	if (protocol == PROTOCOL_NONE)
+		return itfact::common::toHex(itfact::common::hash128(workload, workload_size));
+
+	std::string call_id(workload, workload_size);
+	boost::trim(call_id);
+	return call_id;
+}
+
+/**
+ * @brief		인식 결과를 역색인에 추가 (index.path)
+ * @date		2026. 10. 19. 03:14:02
+ * @param[in]	server		VR 인스턴스
+ * @param[in]	job_name	로그용 작업 이름
+ * @param[in]	call_id		통화 ID
+ * @param[in]	channels	채널별 cell data
+ * @see			TranscriptIndex::add()
+ */
+static inline void __index_result(VRServer *server, const char *job_name, const std::string &call_id,
+								  const std::vector<std::pair<const char *, size_t>> &channels) {
+	TranscriptIndex *index = server->getTranscriptIndex();
+	if (!index)
+		return;
+
+	for (size_t ch = 0; ch < channels.size(); ++ch) {
+		if (index->add(call_id, ch, channels[ch].first, channels[ch].second))
+			job_log->warn("[%s] Fail to index: %s", job_name, call_id.c_str());
+	}
+}
+
+/**
+ * @brief		설정된 외부 도구(stt.decoder, stt.separator) 실행
+ * @details		셸을 거치지 않고 실행하며 stt.tool_timeout이 지나면 강제 종료한다.
+ * @date		2026. 10. 18. 23:31:26
+ * @param[in]	key		도구 설정 키
+ * @param[in]	args	추가 인수
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a non-zero value is returned.
+ * @see			itfact::common::execute()
+ */
+static inline int __run_tool(VRServer *server, const char *job_name, const char *key,
+							 const std::vector<std::string> &args) {
+	std::vector<std::string> argv = itfact::common::splitCommand(server->getConfig()->getConfig(key));
+	argv.insert(argv.end(), args.begin(), args.end());
+	std::string command = itfact::common::toString(argv);
+	job_log->debug("[%s, 0x%X] %s", job_name, THREAD_ID, command.c_str());
+
+	int rc = itfact::common::execute(argv, server->getConfig()->getConfig("stt.tool_timeout", 600000L));
+	if (rc == -ETIMEDOUT)
+		job_log->error("[%s] Timed out: %s", job_name, command.c_str());
+	else if (rc)
+		job_log->error("[%s] Error(%d) occurred during execution '%s'", job_name, rc, command.c_str());
+	return rc;
+}
+
 /**
 * @brief		chilkat 라이브러리를 이용한 SFTP 다운로드 처리
 * @author		TaeBong Wang (tbwang@itfact.co.kr)
@@ -860,6 +1215,9 @@ static inline bool __ftps_download(std::string remote_file, std::string local_fi
  * @see			job_unsegment()
  */
 static gearman_return_t job_stt(gearman_job_st *job, void *context) {
+	if (__feature_request(job))
+		return job_stt_feature(job, context);
+
 	const char *workload = (const char *) gearman_job_workload(job);
 	const size_t workload_size = gearman_job_workload_size(job);
 	std::string __job_name(COLOR_BLACK_BOLD);
@@ -1065,16 +1423,11 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 			
 			// 바이너리 호출로 대체 
 			if (server->getConfig()->isSet("stt.decoder")) {
-				std::string cmd = "";
-				cmd = server->getConfig()->getConfig("stt.decoder");
-				cmd.push_back(' ');
-				cmd.append(input_file.c_str());
+				std::vector<std::string> args = {input_file};
 				if (server->getConfig()->isSet("spk.enable") && server->getConfig()->getConfig("spk.enable").compare("true") == 0) {
-					cmd.push_back(' ');
-					cmd.append("spk_16k_only");
+					args.push_back("spk_16k_only");
 				}
-				job_log->debug("[%s, 0x%X] %s", job_name, THREAD_ID, cmd.c_str());
-				if (std::system(cmd.c_str())) {
+				if (__run_tool(server, job_name, "stt.decoder", args)) {
 					std::string resp = default_config.fail_decoding;
 					resp.push_back('\n');
 					resp.append(server->server_name);
@@ -1139,16 +1492,11 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 
 		// 바이너리 호출로 대체 
 		if (server->getConfig()->isSet("stt.decoder")) {
-			std::string cmd = "";
-			cmd = server->getConfig()->getConfig("stt.decoder");
-			cmd.push_back(' ');
-			cmd.append(input_file.c_str());
+			std::vector<std::string> args = {input_file};
 			if (server->getConfig()->isSet("spk.enable") && server->getConfig()->getConfig("spk.enable").compare("true") == 0) {
-				cmd.push_back(' ');
-				cmd.append("spk");
+				args.push_back("spk");
 			}
-			//job_log->debug("[%s, 0x%X] %s", job_name, THREAD_ID, cmd.c_str());
-			if (std::system(cmd.c_str())) {
+			if (__run_tool(server, job_name, "stt.decoder", args)) {
 				std::string resp = default_config.fail_decoding;
 				resp.push_back('\n');
 				resp.append(server->server_name);
@@ -1219,13 +1567,8 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 
 		// 바이너리 호출로 대체 
 		if (server->getConfig()->isSet("stt.separator")) {
-			std::string cmd(server->getConfig()->getConfig("stt.separator"));
-			cmd.push_back(' ');
-			cmd.append(input_file.c_str());
-			cmd.push_back(' ');
-			cmd.append(input_file.substr(0, input_file.rfind("/")));
-			job_log->debug("[%s] %s", job_name, cmd.c_str());
-			if (std::system(cmd.c_str())) {
+			if (__run_tool(server, job_name, "stt.separator",
+						   {input_file, input_file.substr(0, input_file.rfind("/"))})) {
 				job_log->error("[%s] Fail to separation: %s", job_name, input_file.c_str());
 				gearman_job_send_fail(job);
 
@@ -1251,6 +1594,10 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 
 		// 분리된 파일 처리 
 		std::string part_data[2];
+		std::string checkpoint[2];
+		std::string feature[2];
+		const bool use_analytics = __use_analytics(server);
+		SpeechAnalytics analytics[2];
 		for (int ch_idx = 0; ch_idx < 2; ++ch_idx) {
 			job_log->info("[%s] part_data[%d] stt job prepare.", job_name, ch_idx);
 			output_file = std::string(input_file.c_str(), input_file.size() - 4);
@@ -1278,7 +1625,11 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 			data = (short *) &*buffer.begin();
 			size = buffer.size();
 
-			if (!__job_stt(server, data, size, stt_thread_num, part_data[ch_idx])) {
+			std::string digest = __digest(server, data, size);
+			checkpoint[ch_idx] = __checkpoint_name(server, digest, ch_idx == 0 ? "_left" : "_right");
+			feature[ch_idx] = __feature_name(server, digest, ch_idx == 0 ? "_left" : "_right");
+			if (!__job_stt(server, data, size, stt_thread_num, part_data[ch_idx], digest, checkpoint[ch_idx],
+						   feature[ch_idx], use_analytics ? &analytics[ch_idx] : NULL)) {
 				job_log->error("[%s] Fail to stt", job_name);
 				gearman_job_send_fail(job);
 				return GEARMAN_ERROR;
@@ -1296,12 +1647,41 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 		resHdr.push_back('\n');
 		std::string fsize(boost::lexical_cast<std::string>(size * sizeof(short)));
 		resHdr.append(fsize);
+
+		// 통화 분석 지표와 특징 벡터 파일명은 헤더의 크기 뒤에 추가
+		std::string metrics;
+		if (use_analytics)
+			appendAnalytics(metrics, {&analytics[0], &analytics[1]},
+							countWords(part_data[0].data(), part_data[0].size()) +
+							countWords(part_data[1].data(), part_data[1].size()));
+		if (!feature[0].empty())
+			__append_feature(metrics, {feature[0], feature[1]});
+		resHdr.append(metrics);
 		std::string merge_data(resHdr);
 		merge_data.push_back('\n');
  		merge_data.append(part_data[0]);
  		merge_data.append("||");
  		merge_data.append(part_data[1]);
 
+		bool compress = false;
+		if (__binary_result(job, compress)) {
+			merge_data.clear();
+			__encode_result(server, size * sizeof(short), "", metrics,
+							{std::make_pair(part_data[0].data(), part_data[0].size()),
+							 std::make_pair(part_data[1].data(), part_data[1].size())},
+							compress, merge_data);
+		}
+		else if (__text_result(job)) {
+			if (__attach_text(server, resHdr,
+							  {std::make_pair(part_data[0].data(), part_data[0].size()),
+							   std::make_pair(part_data[1].data(), part_data[1].size())},
+							  merge_data)) {
+				job_log->error("[%s] Fail to unsegment", job_name);
+				gearman_job_send_fail(job);
+				return GEARMAN_ERROR;
+			}
+		}
+
 
 		//job_log->debug("[%s] Done: %d bytes, %s", job_name, merge_data.size(), merge_data.c_str());
 		job_log->debug("[%s] Done: %d bytes", job_name, merge_data.size());
@@ -1309,6 +1689,15 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 			job_log->error("[%s] Fail to send result", job_name);
 			return GEARMAN_ERROR;
 		}
+
+		__index_result(server, job_name, __call_id(workload, workload_size, protocol),
+					   {std::make_pair(part_data[0].data(), part_data[0].size()),
+						std::make_pair(part_data[1].data(), part_data[1].size())});
+
+		for (auto &&pathname : checkpoint) {
+			if (!pathname.empty())
+				std::remove(pathname.c_str());
+		}
 		
 		return GEARMAN_SUCCESS;
 	}
@@ -1321,13 +1710,31 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 	resHdr.append(fsize);
 	std::string cell_data(resHdr);
 	cell_data.push_back('\n');
-	if (!__job_stt(server, data, size, stt_thread_num, cell_data)) {
+	std::string digest = __digest(server, data, size);
+	std::string checkpoint = __checkpoint_name(server, digest, "");
+	const std::string feature = __feature_name(server, digest, "");
+	const bool use_analytics = __use_analytics(server);
+	SpeechAnalytics analytics;
+	if (!__job_stt(server, data, size, stt_thread_num, cell_data, digest, checkpoint,
+				   feature, use_analytics ? &analytics : NULL)) {
 		job_log->error("[%s] Fail to stt", job_name);
 		gearman_job_send_fail(job);
 		std::remove(input_file.c_str());
 		return GEARMAN_ERROR;
 	}
 
+	// 통화 분석 지표와 특징 벡터 파일명은 헤더의 크기 뒤에 추가
+	std::string metrics;
+	if (use_analytics)
+		appendAnalytics(metrics, {&analytics},
+						countWords(cell_data.data() + resHdr.size() + 1, cell_data.size() - resHdr.size() - 1));
+	if (!feature.empty())
+		__append_feature(metrics, {feature});
+	if (!metrics.empty()) {
+		cell_data.insert(resHdr.size(), metrics);
+		resHdr.append(metrics);
+	}
+
 	// 파일 삭제
 	if (protocol != PROTOCOL_FILE)
 		std::remove(input_file.c_str());
@@ -1342,31 +1749,52 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 	// }
 	
 	std::string final_text("");
-
-	if (server->getConfig()->isSet("spk.enable") && server->getConfig()->getConfig("spk.enable").compare("true") == 0) {
-		final_text.push_back('{');
-		final_text.push_back('"');
-		final_text.append("spk_flag");
-		final_text.push_back('"');
-		final_text.push_back(':');
-		final_text.push_back('"');
-		final_text.append("true");
-		final_text.push_back('"');
-		final_text.push_back(',');
-		final_text.push_back('"');
-		final_text.append("spk_node");
-		final_text.push_back('"');
-		final_text.push_back(':');
-		final_text.push_back('"');
-		if (server->getConfig()->isSet("spk.worker_name")) {
-			final_text.append(server->getConfig()->getConfig("spk.worker_name"));
+	const bool use_spk = server->getConfig()->isSet("spk.enable") &&
+						 server->getConfig()->getConfig("spk.enable").compare("true") == 0;
+
+	bool compress = false;
+	if (__binary_result(job, compress)) {
+		// 화자분리 정보와 STT 결과를 함께 바이너리로 전송
+		std::string spk_node;
+		if (use_spk)
+			spk_node = server->getConfig()->isSet("spk.worker_name") ?
+					   server->getConfig()->getConfig("spk.worker_name") : std::string("vr_spk");
+		const size_t header_size = resHdr.size() + 1;
+		__encode_result(server, size * sizeof(short), spk_node, metrics,
+						{std::make_pair(cell_data.data() + header_size, cell_data.size() - header_size)},
+						compress, final_text);
+
+		job_log->debug("[%s] STT(BIN) Done: %s (%lu bytes)", job_name, input_file.c_str(), final_text.size());
+		gearman_return_t ret = gearman_job_send_complete(job, final_text.c_str(), final_text.size());
+		if (gearman_failed(ret)) {
+			job_log->error("[%s] Fail to send result", job_name);
+			return GEARMAN_ERROR;
 		}
-		else {
-			final_text.append("vr_spk");
+	}
+	else if (__text_result(job)) {
+		// STT 결과와 후처리 텍스트를 함께 전송
+		const size_t header_size = resHdr.size() + 1;
+		std::string response;
+		if (__attach_text(server, resHdr,
+						  {std::make_pair(cell_data.data() + header_size, cell_data.size() - header_size)},
+						  response)) {
+			job_log->error("[%s] Fail to unsegment", job_name);
+			gearman_job_send_fail(job);
+			return GEARMAN_ERROR;
 		}
-		final_text.push_back('"');
-		final_text.push_back('}');
-		final_text.push_back('\n');
+		if (use_spk)
+			final_text = __spk_header(server);
+		final_text.append(response);
+
+		job_log->debug("[%s] STT(TEXT) Done: %s (%lu bytes)", job_name, input_file.c_str(), final_text.size());
+		gearman_return_t ret = gearman_job_send_complete(job, final_text.c_str(), final_text.size());
+		if (gearman_failed(ret)) {
+			job_log->error("[%s] Fail to send result", job_name);
+			return GEARMAN_ERROR;
+		}
+	}
+	else if (use_spk) {
+		final_text = __spk_header(server);
 		final_text.append(cell_data);
 
 		// 결과 전송 
@@ -1400,6 +1828,13 @@ static gearman_return_t job_stt(gearman_job_st *job, void *context) {
 	//	return GEARMAN_ERROR;
 	//}
 
+	const size_t header_size = resHdr.size() + 1;
+	__index_result(server, job_name, __call_id(workload, workload_size, protocol),
+				   {std::make_pair(cell_data.data() + header_size, cell_data.size() - header_size)});
+
+	if (!checkpoint.empty())
+		std::remove(checkpoint.c_str());
+
 	// buffer가 비어있지 않으면 비운다
 	if (!buffer.empty())
 		buffer.clear();
@@ -1487,6 +1922,17 @@ static gearman_return_t job_unsegment(gearman_job_st *job, void *context) {
 	return GEARMAN_SUCCESS;
 }
 
+/**
+ * @brief		Unsegment pause 설정
+ * @date		2026. 10. 18. 22:04:51
+ * @return		stt.unsegment_pause (설정이 없다면 SPLPostProcMLF 함수를 타도록 -1)
+ */
+static inline int __unsegment_pause(VRServer *server) {
+	if (server->getConfig()->isSet("stt.unsegment_pause"))
+		return server->getConfig()->getConfig("stt.unsegment_pause", 100);
+	return -1;
+}
+
 /**
  * @brief		Unsegment(with Time) 요청
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
@@ -1515,55 +1961,16 @@ static gearman_return_t job_unsegment_with_time(gearman_job_st *job, void *conte
 		return GEARMAN_ERROR;
 	}
 
-	// FIXME: 임시로 파일 저장 
-	std::string mlf_pathname(tmp_path);
-	mlf_pathname.append(gearman_job_handle(job));
-	std::string text_pathname(mlf_pathname);
-	text_pathname.append(".txt");
-	mlf_pathname.append(".mlf");
-	job_log->debug("[%s] mlf file : %s", job_name, mlf_pathname.c_str());
-	job_log->debug("[%s] text file : %s", job_name, text_pathname.c_str());
-	
-	if (save_data(mlf_pathname, workload_size, workload)) {
-		job_log->error("[%s] Fail to recieve data", job_name);
-		return GEARMAN_ERROR;
-	}
-	
-
 	// Unsegment 
 	std::string text = "SUCCESS\n";
 	text.append(server->server_name);
 	text.push_back('\n');
 	try {
-		int unsegment_pause = 100;
-		if (server->getConfig()->isSet("stt.unsegment_pause")) {
-			unsegment_pause = server->getConfig()->getConfig("stt.unsegment_pause", unsegment_pause);
-		}
-		else {
-			unsegment_pause = -1;	// env.conf 파일에서 설정이 없다면 -1로 설정하여 SPLPostProcMLF 함수를 타도록 함
-		}
-
-		if (server->unsegment_with_time(mlf_pathname, text_pathname, unsegment_pause)) {
+		if (server->unsegment_with_time(workload, workload_size, text, __unsegment_pause(server))) {
 			job_log->error("[%s] Fail to unsegment_with_time", job_name);
 			gearman_job_send_fail(job);
 			return GEARMAN_ERROR;
 		}
-
-		// FIXME: 임시로 파일 리드 
-		std::ifstream text_file(text_pathname);
-		if (text_file.is_open()) {
-			for (std::string line; std::getline(text_file, line); ) {
-				text.append(line);
-				text.push_back('\n');
-			}
-			text_file.close();
-
-			//job_log->debug("[%s] unsegment_with_time text : %s", job_name, text.c_str());
-		} else
-			throw std::runtime_error("Cannot load data");
-
-		std::remove(mlf_pathname.c_str());
-		std::remove(text_pathname.c_str());
 	} catch(std::exception &e) {
 		job_log->error("[%s] Fail to unsegment_with_time, %s", job_name, e.what());
 		gearman_job_send_fail(job);
@@ -1585,6 +1992,162 @@ static gearman_return_t job_unsegment_with_time(gearman_job_st *job, void *conte
 	return GEARMAN_SUCCESS;
 }
 
+/**
+ * @brief		일괄 요청 분리
+ * @details		요청: (<크기>\n<데이터>)*, 끝에 빈 줄이 하나 더 있을 수 있다.
+ * @date		2026. 10. 19. 09:02:48
+ * @param[out]	items	항목별 (데이터, 크기)
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+static int __split_batch(const char *job_name, const char *workload, const size_t workload_size,
+						 std::vector<std::pair<const char *, size_t>> &items) {
+	for (size_t offset = 0; offset < workload_size; ) {
+		const char *eol = (const char *) std::memchr(workload + offset, '\n', workload_size - offset);
+		if (!eol) {
+			job_log->error("[%s] Invalid batch header at %lu", job_name, offset);
+			return EXIT_FAILURE;
+		}
+		// 요청 끝의 빈 줄은 항목이 아님 (vr_text_batch의 원래 형식)
+		if (eol == workload + offset && offset + 1 == workload_size)
+			break;
+
+		// workload는 NUL로 끝나지 않으므로 strtoul()을 쓰지 않고 헤더 줄 안의 숫자만 읽음
+		const char *digit = workload + offset;
+		size_t size = 0;
+		for (; digit < eol && *digit >= '0' && *digit <= '9'; ++digit) {
+			if (size > (workload_size - (*digit - '0')) / 10)
+				break;
+			size = size * 10 + (*digit - '0');
+		}
+		if (digit == workload + offset || digit != eol) {
+			job_log->error("[%s] Invalid batch header at %lu", job_name, offset);
+			return EXIT_FAILURE;
+		}
+		offset = eol - workload + 1;
+		if (size > workload_size - offset) {
+			job_log->error("[%s] Invalid batch item size at %lu", job_name, offset);
+			return EXIT_FAILURE;
+		}
+		items.push_back(std::make_pair(workload + offset, size));
+		offset += size;
+	}
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief		일괄 요청 처리
+ * @details		요청: (<크기>\n<데이터>)*
+ 				응답: SUCCESS\n<서버>\n<개수>\n 뒤에 요청 순서대로 항목마다 <SUCCESS|FAIL>\t<크기>\n<결과>
+ 				각 항목은 unsegment.batch_threads 크기의 스레드 풀에서 나눠 처리한다.
+ * @date		2026. 10. 18. 22:11:37
+ * @param[in]	label	로그에 표시할 작업 이름
+ * @param[in]	fn		항목별 처리 함수 (데이터, 크기, 결과)
+ * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
+ 				Otherwise, a GEARMAN_ERROR is returned.
+ */
+static gearman_return_t __job_batch(gearman_job_st *job, VRServer *server, const char *label,
+		const std::function<int (const char *, const size_t, std::string &)> &fn) {
+	const char *workload = (const char *) gearman_job_workload(job);
+	const size_t workload_size = gearman_job_workload_size(job);
+	std::string __job_name(COLOR_BLACK_BOLD);
+	__job_name.append(label);
+	__job_name.push_back(':');
+	__job_name.append(gearman_job_handle(job));
+	__job_name.append(COLOR_NC);
+	const char *job_name = __job_name.c_str();
+
+	job_log->debug("[%s, 0x%X] Recieved %d bytes", job_name, THREAD_ID, workload_size);
+
+	// 요청 분리 
+	std::vector<std::pair<const char *, size_t>> items;
+	if (__split_batch(job_name, workload, workload_size, items) != EXIT_SUCCESS) {
+		gearman_job_send_fail(job);
+		return GEARMAN_ERROR;
+	}
+
+	// 항목별 처리 
+	std::vector<std::string> texts(items.size());
+	std::vector<std::future<int>> results;
+	for (size_t i = 0; i < items.size(); ++i) {
+		const char *data = items[i].first;
+		const size_t size = items[i].second;
+		std::string *text = &texts[i];
+		std::function<int ()> task = [&fn, data, size, text]() {
+			return fn(data, size, *text);
+		};
+		if (unsegment_pool) {
+			results.push_back(unsegment_pool->submit(task));
+		} else {
+			std::promise<int> result;
+			result.set_value(task());
+			results.push_back(result.get_future());
+		}
+	}
+
+	std::string response = "SUCCESS\n";
+	response.append(server->server_name);
+	response.push_back('\n');
+	response.append(std::to_string(items.size()));
+	response.push_back('\n');
+	size_t failures = 0;
+	for (size_t i = 0; i < items.size(); ++i) {
+		int result = EXIT_FAILURE;
+		try {
+			result = results[i].get();
+		} catch(std::exception &e) {
+			job_log->error("[%s] Fail to process item %lu, %s", job_name, i, e.what());
+		}
+		if (result) {
+			++failures;
+			texts[i].clear();
+		}
+		response.append(result ? "FAIL\t" : "SUCCESS\t");
+		response.append(std::to_string(texts[i].size()));
+		response.push_back('\n');
+		response.append(texts[i]);
+	}
+
+	// 결과 전송 
+	job_log->debug("[%s] Done: %lu items (%lu failed), %lu bytes", job_name, items.size(), failures, response.size());
+	gearman_return_t ret = gearman_job_send_complete(job, response.c_str(), response.size());
+	if (gearman_failed(ret)) {
+		job_log->error("[%s] Fail to send result", job_name);
+		return GEARMAN_ERROR;
+	}
+
+	return GEARMAN_SUCCESS;
+}
+
+/**
+ * @brief		Unsegment(with Time) 일괄 요청 (vr_text_batch)
+ * @details		항목은 MLF이며 결과는 vr_text의 텍스트(SUCCESS 헤더 제외)와 같다.
+ * @date		2026. 10. 18. 22:11:37
+ * @see			job_unsegment_with_time()
+ */
+static gearman_return_t job_unsegment_batch(gearman_job_st *job, void *context) {
+	VRServer *server = (VRServer *) context;
+	const int pause = __unsegment_pause(server);
+	return __job_batch(job, server, "UnsegmentBatch",
+		[server, pause](const char *data, const size_t size, std::string &text) {
+			return server->unsegment_with_time(data, size, text, pause);
+		});
+}
+
+/**
+ * @brief		Unsegment 일괄 요청 (vr_text_only_batch)
+ * @details		항목은 셀 데이터이며 결과는 vr_text_only와 같다.
+ * @date		2026. 10. 19. 00:58:31
+ * @see			job_unsegment()
+ */
+static gearman_return_t job_unsegment_only_batch(gearman_job_st *job, void *context) {
+	VRServer *server = (VRServer *) context;
+	return __job_batch(job, server, "UnsegmentOnlyBatch",
+		[server](const char *data, const size_t size, std::string &text) {
+			return server->unsegment(std::string(data, size), text);
+		});
+}
+
 static int DecodeMimeBase64[256] = {
 	-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  /* 00-0F */
 	-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  /* 10-1F */
@@ -1682,7 +2245,8 @@ static gearman_return_t job_ssp(gearman_job_st *job, void *context) {
 	std::string recv_data(workload, workload_size);
 	std::vector<std::string> lines;
 	boost::split(lines, recv_data, boost::is_any_of("\n"));
-	bool useUtil = server->getConfig()->isSet("ssp.util"); 
+	// ssp.server는 MlfClassify와 같은 MLF 형식을 사용
+	bool useUtil = !server->hasSspServer() && server->getConfig()->isSet("ssp.util");
 	for (size_t i = 0; i < lines.size(); ++i) {
 		std::vector<std::string> line;
 		boost::split(line, lines[i], boost::is_any_of("\t"));
@@ -1707,23 +2271,33 @@ static gearman_return_t job_ssp(gearman_job_st *job, void *context) {
 		mlf_data.push_back('\n');
 	}
 
-	// FIXME: 임시로 파일 저장 
-	std::string pathname(tmp_path);
-	pathname.append(gearman_job_handle(job));
-	pathname.append(".mlf");
-	if (save_data(pathname, mlf_data.size(), mlf_data.c_str())) {
-		job_log->error("[%s] Fail to recieve data", job_name);
-		return GEARMAN_ERROR;
-	}
-
 	std::string result;
 	try {
-		if (server->ssp(pathname, result)) {
-			job_log->error("[%s] Fail to ssp", job_name);
-			gearman_job_send_fail(job);
-			return GEARMAN_ERROR;
+		if (server->hasSspServer()) {
+			// 상주 프로세스로 파일 없이 처리
+			if (server->ssp_request(mlf_data, result)) {
+				job_log->error("[%s] Fail to ssp", job_name);
+				gearman_job_send_fail(job);
+				return GEARMAN_ERROR;
+			}
+		} else {
+			// FIXME: 임시로 파일 저장 
+			std::string pathname(tmp_path);
+			pathname.append(gearman_job_handle(job));
+			pathname.append(".mlf");
+			if (save_data(pathname, mlf_data.size(), mlf_data.c_str())) {
+				job_log->error("[%s] Fail to recieve data", job_name);
+				return GEARMAN_ERROR;
+			}
+
+			if (server->ssp(pathname, result)) {
+				std::remove(pathname.c_str());
+				job_log->error("[%s] Fail to ssp", job_name);
+				gearman_job_send_fail(job);
+				return GEARMAN_ERROR;
+			}
+			std::remove(pathname.c_str());
 		}
-		std::remove(pathname.c_str());
 	} catch(std::exception &e) {
 		job_log->error("[%s] Fail to ssp, %s", job_name, e.what());
 		gearman_job_send_fail(job);
@@ -1745,8 +2319,53 @@ static gearman_return_t job_ssp(gearman_job_st *job, void *context) {
 	return GEARMAN_SUCCESS;
 }
 
+/**
+ * @brief		실시간 STT 패킷 처리
+ * @details		vr_realtime 작업과 스트리밍 연결(StreamServer)이 같이 사용한다.
+ 			LAST 패킷의 결과는 서버 이름으로 시작한다.
+ * @date		2026. 10. 19. 08:41:23
+ * @param[in]	server		VR 서버
+ * @param[in]	job_name	로그에 쓸 작업 이름
+ * @param[in]	packet		패킷
+ * @param[out]	text		Unsegment 결과
+ * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
+ 				Otherwise, a EXIT_FAILURE is returned.
+ */
+static int __rt_stt(VRServer *server, const char *job_name, const rt_packet_t &packet, std::string &text) {
+	// STT (v2 패킷은 지터 버퍼를 거치므로 이 작업에서 디코딩한 패킷이 없거나 여러 개일 수 있음)
+	std::vector<std::pair<char, std::string>> cell_data;
+	if (server->stt(packet, cell_data) == EXIT_FAILURE) {
+		job_log->error("[%s] Fail to stt", job_name);
+		return EXIT_FAILURE;
+	}
+	job_log->debug("[%s] Done: %lu packets", job_name, cell_data.size());
+
+	for (auto &&cells : cell_data) {
+		if (cells.first == 2) {
+			text = server->server_name;
+			text.push_back('\n');
+		}
+	}
+	try {
+		for (auto &&cells : cell_data) {
+			if (server->unsegment_realtime(cells.second, text)) {
+				job_log->error("[%s] Fail to unsegment", job_name);
+				return EXIT_FAILURE;
+			}
+		}
+	} catch(std::exception &e) {
+		job_log->error("[%s] Fail to unsegment, %s", job_name, e.what());
+		return EXIT_FAILURE;
+	} catch(std::exception *e) {
+		job_log->error("[%s] Fail to unsegment, %s", job_name, e->what());
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
 /**
  * @brief		Realtime STT 요청 
+ * @details		패킷 형식은 rt_packet.hpp 참고 (v1: "CALL_ID|CMD|DATA", v2: 바이너리 헤더)
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2017. 03. 14. 10:15:34
  * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
@@ -1771,34 +2390,19 @@ static gearman_return_t job_rt_stt(gearman_job_st *job, void *context) {
 	}
 
 	// 명령어 해석 
-	// CALL_ID | CMD | DATA
-	char *tmp = const_cast<char *>(workload);
-	tmp = strchr(tmp, '|');
-	if (tmp == NULL) {
-		job_log->error("[%s] Cannot find Call ID", job_name);
+	static thread_local std::vector<short> decoded;
+	rt_packet_t packet;
+	std::string error;
+	if (parsePacket(workload, workload_size, packet, decoded, error) != EXIT_SUCCESS) {
+		job_log->error("[%s] %s", job_name, error.c_str());
 		gearman_job_send_fail(job);
 		return GEARMAN_ERROR;
 	}
 
-	int idx_call_id = tmp - workload;
-	std::string call_id(workload, idx_call_id);
-
-	tmp = strchr(tmp + 1, '|');
-	if (tmp == NULL) {
-		job_log->error("[%s] Invalid argument", job_name);
-		gearman_job_send_fail(job);
-		return GEARMAN_ERROR;
-	}
-
-	int idx_cmd = tmp - workload;
-	std::string cmd(workload + idx_call_id + 1, idx_cmd - idx_call_id - 1);
-	char state = 1;
-
-	if (cmd.find("FIRS") == 0) state = 0;
-	else if (cmd.find("LAST") == 0) state = 2;
-
-	short *data = (short *) (tmp + 1);
-	size_t size = (workload_size - idx_cmd - 1) / sizeof(short);
+	const std::string &call_id = packet.call_id;
+	const char state = packet.state;
+	const short *data = packet.pcm;
+	size_t size = packet.samples;
 
 	// DEBUG, fvad를 이용하여 음성 데이터 처리 확인
 	if (0) {
@@ -1821,44 +2425,269 @@ static gearman_return_t job_rt_stt(gearman_job_st *job, void *context) {
 	for (size_t i = 0; i < size; ++i)
 		data[i] = ntohs(data[i]);
 #endif
-	job_log->debug("[%s] Call ID: %s[%s], length: %lu, state(%d)", job_name, call_id.c_str(), cmd.c_str(), size, state);
-	// STT
-	std::string cell_data = "";
-	if (server->stt(call_id, data, size, (const char)state, cell_data) == EXIT_FAILURE) {
-		job_log->error("[%s] Fail to stt", job_name);
+	if (packet.version == 1)
+		job_log->debug("[%s] Call ID: %s[%s], length: %lu, state(%d)", job_name, call_id.c_str(),
+					   packet.command.c_str(), size, state);
+	else
+		job_log->debug("[%s] Call ID: %s[#%u], codec: %u, timestamp: %lu, length: %lu, state(%d)", job_name,
+					   call_id.c_str(), packet.sequence, packet.codec, packet.timestamp, size, state);
+	std::string text;
+	if (__rt_stt(server, job_name, packet, text) != EXIT_SUCCESS) {
 		gearman_job_send_fail(job);
 		return GEARMAN_ERROR;
 	}
 
 	// 결과 전송 
-	job_log->debug("[%s] Done: %d bytes", job_name, cell_data.size());
-#if 1
-	std::string text="";
+	gearman_return_t ret = gearman_job_send_complete(job, text.c_str(), text.size());
 
-	if (state == 2) {
-		text = server->server_name;
-		text.push_back('\n');
+	if (gearman_failed(ret)) {
+		job_log->error("[%s] Fail to send result", job_name);
+		return GEARMAN_ERROR;
 	}
-	try {
-		if (server->unsegment(cell_data, text)) {
-			job_log->error("[%s] Fail to unsegment", job_name);
-			gearman_job_send_fail(job);
-			return GEARMAN_ERROR;
+
+	return GEARMAN_SUCCESS;
+}
+
+/**
+ * @brief		여러 통화의 Realtime STT 요청 (vr_realtime_mux)
+ * @details		요청과 응답 형식은 일괄 요청(__job_batch())과 같으며 항목은 vr_realtime 패킷, 결과는 vr_realtime 결과이다.
+ 			항목은 Call ID별로 묶어 realtime.mux_threads 크기의 스레드 풀에서 통화마다 요청 순서대로 처리하므로
+ 			여러 통화의 패킷이 한 번의 작업으로 각 채널에 나뉘어 처리된다.
+ * @date		2026. 10. 19. 09:05:36
+ * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
+ 				Otherwise, a GEARMAN_ERROR is returned.
+ * @see			job_rt_stt()
+ */
+static gearman_return_t job_rt_mux(gearman_job_st *job, void *context) {
+	const char *workload = (const char *) gearman_job_workload(job);
+	const size_t workload_size = gearman_job_workload_size(job);
+	std::string __job_name(COLOR_BLACK_BOLD);
+	__job_name.append("RTMux:");
+	__job_name.append(gearman_job_handle(job));
+	__job_name.append(COLOR_NC);
+	const char *job_name = __job_name.c_str();
+	VRServer *server = (VRServer *) context;
+
+	job_log->info("[%s] Recieved %d bytes", job_name, workload_size);
+	std::vector<std::pair<const char *, size_t>> items;
+	if (__split_batch(job_name, workload, workload_size, items) != EXIT_SUCCESS) {
+		gearman_job_send_fail(job);
+		return GEARMAN_ERROR;
+	}
+
+	// 패킷 해석 및 통화별 분류 
+	std::vector<rt_packet_t> packets(items.size());
+	std::vector<std::vector<short>> decoded(items.size());
+	std::vector<std::string> texts(items.size());
+	std::vector<int> results(items.size(), EXIT_FAILURE);
+	std::vector<std::string> call_ids;
+	std::unordered_map<std::string, std::vector<size_t>> calls;
+	for (size_t i = 0; i < items.size(); ++i) {
+		std::string error;
+		if (parsePacket(items[i].first, items[i].second, packets[i], decoded[i], error) != EXIT_SUCCESS) {
+			job_log->error("[%s] Item %lu: %s", job_name, i, error.c_str());
+			continue;
 		}
-	} catch(std::exception &e) {
-		job_log->error("[%s] Fail to unsegment, %s", job_name, e.what());
+
+		std::vector<size_t> &indexes = calls[packets[i].call_id];
+		if (indexes.empty())
+			call_ids.push_back(packets[i].call_id);
+		indexes.push_back(i);
+	}
+
+	// 통화별 처리 
+	std::vector<std::future<int>> futures;
+	for (auto &&call_id : call_ids) {
+		const std::vector<size_t> *indexes = &calls[call_id];
+		std::function<int ()> task = [server, job_name, indexes, &packets, &texts, &results]() {
+			for (auto &&i : *indexes)
+				results[i] = __rt_stt(server, job_name, packets[i], texts[i]);
+			return EXIT_SUCCESS;
+		};
+		if (realtime_pool) {
+			futures.push_back(realtime_pool->submit(task));
+		} else {
+			std::promise<int> result;
+			result.set_value(task());
+			futures.push_back(result.get_future());
+		}
+	}
+	for (auto &&future : futures) {
+		try {
+			future.get();
+		} catch(std::exception &e) {
+			job_log->error("[%s] Fail to process call, %s", job_name, e.what());
+		}
+	}
+
+	std::string response = "SUCCESS\n";
+	response.append(server->server_name);
+	response.push_back('\n');
+	response.append(std::to_string(items.size()));
+	response.push_back('\n');
+	size_t failures = 0;
+	for (size_t i = 0; i < items.size(); ++i) {
+		if (results[i]) {
+			++failures;
+			texts[i].clear();
+		}
+		response.append(results[i] ? "FAIL\t" : "SUCCESS\t");
+		response.append(std::to_string(texts[i].size()));
+		response.push_back('\n');
+		response.append(texts[i]);
+	}
+
+	// 결과 전송 
+	job_log->debug("[%s] Done: %lu packets of %lu calls (%lu failed), %lu bytes", job_name, items.size(),
+				   call_ids.size(), failures, response.size());
+	gearman_return_t ret = gearman_job_send_complete(job, response.c_str(), response.size());
+	if (gearman_failed(ret)) {
+		job_log->error("[%s] Fail to send result", job_name);
+		return GEARMAN_ERROR;
+	}
+
+	return GEARMAN_SUCCESS;
+}
+
+/**
+ * @brief		서버 상태 요청 
+ * @details		함수명은 "vr_stats_<stt.server_name>"이며 workload는 사용하지 않는다.
+ * @date		2026. 10. 18. 14:15:40
+ * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
+ 				Otherwise, a GEARMAN_ERROR is returned.
+ * @see			VRServer::stats()
+ */
+static gearman_return_t job_stats(gearman_job_st *job, void *context) {
+	VRServer *server = (VRServer *) context;
+
+	std::string result;
+	if (server->stats(result)) {
+		job_log->error("[%s] Fail to get stats", gearman_job_handle(job));
 		gearman_job_send_fail(job);
 		return GEARMAN_ERROR;
-	} catch(std::exception *e) {
-		job_log->error("[%s] Fail to unsegment, %s", job_name, e->what());
+	}
+
+	gearman_return_t ret = gearman_job_send_complete(job, result.c_str(), result.size());
+	if (gearman_failed(ret)) {
+		job_log->error("[%s] Fail to send result", gearman_job_handle(job));
+		return GEARMAN_ERROR;
+	}
+
+	return GEARMAN_SUCCESS;
+}
+
+/**
+ * @brief		저장된 특징 벡터로 STT 수행
+ * @details		stt.feature_path가 설정된 경우 vr_stt와 같은 워커에 등록된다.\n
+ 			workload는 vr_stt 응답의 feature 값(stt.feature_path 기준 파일명)이며,
+ 			stt.feature_path 밖의 파일은 거부한다.\n
+ 			언어 모델이나 디코딩 설정을 바꾼 후 특징 추출 없이 다시 디코딩할 때 사용한다.
+ * @date		2026. 10. 18. 18:52:33
+ * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
+ 				Otherwise, a GEARMAN_ERROR is returned.
+ * @see			VRServer::stt_feature()
+ */
+static gearman_return_t job_stt_feature(gearman_job_st *job, void *context) {
+	VRServer *server = (VRServer *) context;
+	const char *job_name = gearman_job_handle(job);
+	std::string pathname((const char *) gearman_job_workload(job), gearman_job_workload_size(job));
+	boost::trim(pathname);
+
+	if (pathname.empty()) {
+		job_log->error("[%s] Invalid workload", job_name);
 		gearman_job_send_fail(job);
 		return GEARMAN_ERROR;
 	}
-	gearman_return_t ret = gearman_job_send_complete(job, text.c_str(), text.size());
-#else
+
+	std::string path = server->getConfig()->getConfig("stt.feature_path");
+	if (path.empty() || path.at(path.size() - 1) != '/')
+		path.push_back('/');
+	if (pathname.at(0) != '/')
+		pathname.insert(0, path);
+
+	// 심볼릭 링크와 ".."을 풀어 stt.feature_path 안의 파일인지 확인
+	std::shared_ptr<char> root(realpath(path.c_str(), NULL), free);
+	std::shared_ptr<char> resolved(realpath(pathname.c_str(), NULL), free);
+	std::string prefix(root ? root.get() : "");
+	if (prefix.empty() || prefix.at(prefix.size() - 1) != '/')
+		prefix.push_back('/');
+	if (!root || !resolved || std::strncmp(resolved.get(), prefix.c_str(), prefix.size()) != 0) {
+		job_log->error("[%s] Invalid feature file: %s", job_name, pathname.c_str());
+		gearman_job_send_fail(job);
+		return GEARMAN_ERROR;
+	}
+	pathname = resolved.get();
+
+	std::string result;
+	std::size_t samples = 0;
+	if (server->stt_feature(pathname, result, samples)) {
+		job_log->error("[%s] Fail to stt: %s", job_name, pathname.c_str());
+		gearman_job_send_fail(job);
+		return GEARMAN_ERROR;
+	}
+
+	std::string cell_data("SUCCESS\n");
+	cell_data.append(server->server_name);
+	cell_data.push_back('\n');
+	cell_data.append(std::to_string(samples * sizeof(short)));
+	cell_data.push_back('\n');
+	cell_data.append(result);
+
+	job_log->debug("[%s] STT Done: %s (%d bytes)", job_name, pathname.c_str(), cell_data.size());
 	gearman_return_t ret = gearman_job_send_complete(job, cell_data.c_str(), cell_data.size());
-#endif
+	if (gearman_failed(ret)) {
+		job_log->error("[%s] Fail to send result", job_name);
+		return GEARMAN_ERROR;
+	}
+
+	return GEARMAN_SUCCESS;
+}
+
+/**
+ * @brief		인식 결과 키워드 검색
+ * @details		함수명은 "vr_search_<stt.server_name>"이며 index.path가 설정된 경우에만 등록한다.\n
+ 			workload는 공백으로 구분한 키워드이며 모든 키워드가 나온 통화를 찾는다. '*'로 끝나는 키워드는 접두어로 검색한다.\n
+ 			응답: SUCCESS\n<서버>\n<출현 수>\n 뒤에 출현마다 <통화 ID>\t<채널>\t<시작>\t<종료>\t<단어>\n\n
+ 			통화 수는 index.search_limit(기본: 1000)로 제한한다.
+ * @date		2026. 10. 19. 03:20:18
+ * @return		Upon successful completion, a GEARMAN_SUCCESS is returned.\n
+ 				Otherwise, a GEARMAN_ERROR is returned.
+ * @see			TranscriptIndex::search()
+ */
+static gearman_return_t job_search(gearman_job_st *job, void *context) {
+	VRServer *server = (VRServer *) context;
+	const char *job_name = gearman_job_handle(job);
+	std::string query((const char *) gearman_job_workload(job), gearman_job_workload_size(job));
+	boost::trim(query);
+
+	std::vector<std::string> keywords;
+	if (!query.empty())
+		boost::split(keywords, query, boost::is_any_of(" \t\r\n"), boost::token_compress_on);
+
+	std::vector<index_hit_t> hits;
+	if (keywords.empty() ||
+		server->getTranscriptIndex()->search(keywords, server->getConfig()->getConfig("index.search_limit", 1000UL),
+											 hits)) {
+		job_log->error("[%s] Invalid query: %s", job_name, query.c_str());
+		gearman_job_send_fail(job);
+		return GEARMAN_ERROR;
+	}
 
+	std::string result("SUCCESS\n");
+	result.append(server->server_name);
+	result.push_back('\n');
+	result.append(std::to_string(hits.size()));
+	result.push_back('\n');
+	for (auto &&hit : hits) {
+		result.append(hit.call_id).push_back('\t');
+		result.append(std::to_string(hit.channel)).push_back('\t');
+		result.append(std::to_string(hit.start)).push_back('\t');
+		result.append(std::to_string(hit.end)).push_back('\t');
+		result.append(hit.word).push_back('\n');
+	}
+
+	job_log->debug("[%s] Search Done: %s (%d hits)", job_name, query.c_str(), hits.size());
+	gearman_return_t ret = gearman_job_send_complete(job, result.c_str(), result.size());
 	if (gearman_failed(ret)) {
 		job_log->error("[%s] Fail to send result", job_name);
 		return GEARMAN_ERROR;
@@ -77,14 +77,19 @@ int WorkerDaemon::initialize(const int argc, const char *argv[]) {
  * @param[in]	host	Connect to the host
  * @param[in]	port	Port number use for connection
  * @param[in]	timeout	Timeout in milliseconds
+ * @param[in]	aliases	같은 함수로 처리할 다른 이름 (gearman_job_function_name()으로 구분)
  * @return		Upon successful completion, a EXIT_SUCCESS is returned.\n
  				Otherwise, a error code is returned indicating what went wrong.
  */
 static int
 worker_thread(const std::string name, const char *host, const int port, const int timeout,
 			  WorkerDaemon *daemon, log4cpp::Category *logger, void *context,
-			  gearman_return_t (*fn)(gearman_job_st *, void *)) {
-	
+			  gearman_return_t (*fn)(gearman_job_st *, void *), const std::vector<std::string> aliases) {
+
+	// 작업 처리 중 필요한 경우 ScopedAffinity로 다른 CPU 집합을 사용한다.
+	if (daemon->getTopology()->bind("gearman"))
+		logger->warn("[%s] Cannot bind worker thread to CPU set", name.c_str());
+
 	gearman_worker_st worker;
 	if (gearman_worker_create(&worker) == NULL) {
 		logger->fatal("[%s] Memory allocation failure on worker creation", name.c_str());
@@ -98,6 +103,8 @@ worker_thread(const std::string name, const char *host, const int port, const in
 	}
 
 	ret = gearman_worker_define_function(&worker, name.c_str(), name.size(), gearman_function_create(fn), timeout, context);
+	for (auto iter = aliases.begin(); iter != aliases.end() && !gearman_failed(ret); ++iter)
+		ret = gearman_worker_define_function(&worker, iter->c_str(), iter->size(), gearman_function_create(fn), timeout, context);
 
 	if (gearman_failed(ret)) {
 		std::cout << gearman_worker_error(&worker) << std::endl;
@@ -148,9 +155,11 @@ unsigned long WorkerDaemon::getTotalWorkers(const std::string &name) {
  * @brief		워커 실행 
  * @author		Kijeong Khil (kjkhil@itfact.co.kr)
  * @date		2016. 06. 20. 16:29:10
+ * @param[in]	aliases	같은 워커에 함께 등록할 함수명
  */
 void WorkerDaemon::run(const std::string name, void *context, unsigned int count,
-						gearman_return_t (*fn)(gearman_job_st *, void *)) {
+						gearman_return_t (*fn)(gearman_job_st *, void *),
+						const std::vector<std::string> &aliases) {
 	logger->info("Initialize %s", name.c_str());
 	//logger->info("Initialize count %d", count);
 	is_running = true;
@@ -161,7 +170,7 @@ void WorkerDaemon::run(const std::string name, void *context, unsigned int count
 			std::string sNewFname = name + "_" + std::to_string(i+sNum);
 			workers.push_back(std::thread(worker_thread, sNewFname,
 					config.getHost().c_str(), config.getPort(), config.getTimeout(),
-					this, logger, context, fn));
+					this, logger, context, fn, aliases));
 		}
 	}
 	else {
@@ -169,7 +178,7 @@ void WorkerDaemon::run(const std::string name, void *context, unsigned int count
 		for (unsigned int i = 0; i < count; ++i) {
 			workers.push_back(std::thread(worker_thread, name,
 						config.getHost().c_str(), config.getPort(), config.getTimeout(),
-						this, logger, context, fn));
+						this, logger, context, fn, aliases));
 		}
 #ifdef USE_REALTIME_MF
 	}